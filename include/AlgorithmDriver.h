@@ -13,6 +13,7 @@
 #include <Enums.h>
 
 #include <map>
+#include <string>
 
 namespace sierra {
 namespace nalu {
@@ -32,6 +33,10 @@ public:
 
   Realm& realm_;
   std::map<AlgorithmType, Algorithm*> algMap_;
+
+private:
+  //! Demangled class name for the profiling region, set on first use
+  std::string profilingName_;
 };
 
 } // namespace nalu
@@ -18,6 +18,7 @@
 #include "SharedMemData.h"
 #include "EquationSystem.h"
 #include "LinearSystem.h"
+#include "utils/CompactEdgeConnectivity.h"
 
 namespace stk {
 namespace mesh {
@@ -47,6 +48,8 @@ public:
   template <typename LambdaFunction>
   void run_algorithm(stk::mesh::BulkData& bulk, LambdaFunction lambdaFunc)
   {
+    realm_.require_stk_edges("AssembleEdgeSolverAlgorithm");
+
     const auto& meta = bulk.mesh_meta_data();
     const auto& ngpMesh = realm_.ngp_mesh();
 
@@ -99,11 +102,69 @@ public:
     coeffApplier.free_coeff_applier();
   }
 
+  /** Loop over the compact edges of the realm instead of the STK edges
+   *
+   *  The lambda receives the index of the edge in the compact edge arrays in
+   *  place of the NGP mesh index of the STK edge.
+   */
+  template <typename LambdaFunction>
+  void run_compact_algorithm(LambdaFunction lambdaFunc)
+  {
+    const auto& ngpMesh = realm_.ngp_mesh();
+    const auto& edges = realm_.compact_edges(partVec_);
+    const auto edgeNodes = edges.edge_nodes();
+    const size_t numEdges = edges.num_edges();
+
+    const int bytes_per_team = 0;
+    const int bytes_per_thread = calc_shmem_bytes_per_thread_edge(rhsSize_);
+
+    // each team handles a fixed size chunk of edges, like an edge bucket
+    const size_t edgesPerTeam = edgesPerTeam_;
+    const size_t numTeams = (numEdges + edgesPerTeam - 1) / edgesPerTeam;
+    auto team_exec =
+      get_device_team_policy(numTeams, bytes_per_team, bytes_per_thread);
+
+    // Create local copies of class data for device capture
+    const auto rhsSize = rhsSize_;
+
+    auto coeffApplier = coeff_applier();
+
+    const auto nodesPerEntity = nodesPerEntity_;
+
+    Kokkos::parallel_for(
+      team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
+        ShmemDataType smdata(team, rhsSize);
+
+        const size_t begin = team.league_rank() * edgesPerTeam;
+        const size_t end =
+          (begin + edgesPerTeam < numEdges) ? begin + edgesPerTeam : numEdges;
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, begin, end), [&](const size_t& ie) {
+            smdata.ngpElemNodes = stk::mesh::NgpMesh::ConnectedNodes(
+              &edgeNodes(ie, 0), nodesPerEntity);
+
+            const auto nodeL = ngpMesh.fast_mesh_index(edgeNodes(ie, 0));
+            const auto nodeR = ngpMesh.fast_mesh_index(edgeNodes(ie, 1));
+
+            set_vals(smdata.rhs, 0.0);
+            set_vals(smdata.lhs, 0.0);
+
+            lambdaFunc(smdata, ie, nodeL, nodeR);
+
+            coeffApplier(
+              nodesPerEntity, smdata.ngpElemNodes, smdata.scratchIds,
+              smdata.sortPermutation, smdata.rhs, smdata.lhs, __FILE__);
+          });
+      });
+    coeffApplier.free_coeff_applier();
+  }
+
 protected:
   ElemDataRequests dataNeeded_;
 
   static constexpr stk::mesh::EntityRank entityRank_{stk::topology::EDGE_RANK};
   static constexpr int nodesPerEntity_{2};
+  static constexpr int edgesPerTeam_{512};
   static constexpr int NDimMax_{3};
   const int rhsSize_;
 };
@@ -17,10 +17,13 @@
 #include <ScratchViews.h>
 #include <SharedMemData.h>
 #include <CopyAndInterleave.h>
+#include <ElemGeometryCache.h>
 #include <FieldTypeDef.h>
 #include <stk_mesh/base/NgpMesh.hpp>
 #include <ngp_utils/NgpFieldManager.h>
 
+#include <memory>
+
 namespace stk {
 namespace mesh {
 class Part;
@@ -74,6 +77,11 @@ public:
     const auto& elem_buckets =
       stk::mesh::get_bucket_ids(bulk_data, entityRank_, elemSelector);
 
+    const auto geomCache = geometryCache_ ? geometryCache_->prepare(
+                                              dataNeededByKernels_, entityRank_,
+                                              elem_buckets)
+                                          : ElemGeometryCacheView();
+
     // Create local copies of class data
     const auto entityRank = entityRank_;
     const auto nodesPerEntity = nodesPerEntity_;
@@ -124,10 +132,23 @@ public:
               smdata.prereqData, numSimdElems, smdata.simdPrereqData);
 #endif
 
-            fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
+            if (geomCache.loading()) {
+              geomCache.load(
+                dataNeededNGP, team.league_rank(), bktIndex,
+                smdata.simdPrereqData);
+            } else {
+              fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
+              if (geomCache.storing())
+                geomCache.store(
+                  dataNeededNGP, team.league_rank(), bktIndex,
+                  smdata.simdPrereqData);
+            }
             lambdaFunc(smdata);
           });
       });
+
+    if (geometryCache_)
+      geometryCache_->populated();
   }
 
   ElemDataRequests dataNeededByKernels_;
@@ -137,6 +158,9 @@ public:
   double diagRelaxFactor_{1.0};
   unsigned nodesPerEntity_;
   int rhsSize_;
+
+  //! Stored master element data, only when requested for element algorithms
+  std::unique_ptr<ElemGeometryCache> geometryCache_;
 };
 
 } // namespace nalu
@@ -0,0 +1,239 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ElemGeometryCache_h
+#define ElemGeometryCache_h
+
+#include <ElemDataRequests.h>
+#include <ElemDataRequestsGPU.h>
+#include <KokkosInterface.h>
+#include <SimdInterface.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+namespace impl {
+
+/** Apply a functor to every master element view of a request that only
+ *  depends on the element coordinates
+ *
+ *  Shape functions are filled once per team and the derivative/Jacobian
+ *  scratch arrays are not consumed by the kernels, so neither is visited.
+ */
+template <typename MEViewsType, typename Func>
+KOKKOS_INLINE_FUNCTION void
+for_each_geometry_view(
+  const ElemDataRequestsGPU::DataEnumView& dataEnums,
+  MEViewsType& meViews,
+  Func& func)
+{
+  for (unsigned i = 0; i < dataEnums.size(); ++i) {
+    switch (dataEnums(i)) {
+    case SCS_AREAV:
+      func(meViews.scs_areav);
+      break;
+    case SCS_GRAD_OP:
+      func(meViews.dndx);
+      break;
+    case SCS_SHIFTED_GRAD_OP:
+      func(meViews.dndx_shifted);
+      break;
+    case SCS_GIJ:
+      func(meViews.gijUpper);
+      func(meViews.gijLower);
+      break;
+    case SCS_MIJ:
+    case SCV_MIJ:
+      func(meViews.metric);
+      break;
+    case SCV_VOLUME:
+      func(meViews.scv_volume);
+      break;
+    case SCV_GRAD_OP:
+      func(meViews.dndx_scv);
+      break;
+    case SCV_SHIFTED_GRAD_OP:
+      func(meViews.dndx_scv_shifted);
+      break;
+    case FEM_GRAD_OP:
+    case FEM_SHIFTED_GRAD_OP:
+      func(meViews.dndx_fem);
+      func(meViews.det_j_fem);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+} // namespace impl
+
+/** Device handle to the cached master element data of one algorithm
+ *
+ *  Rows are SIMD element groups, ordered by bucket (in the order of the
+ *  algorithm's bucket list) and then by group within the bucket.
+ */
+class ElemGeometryCacheView
+{
+public:
+  using DataView = Kokkos::View<DoubleType**, MemSpace>;
+  using OffsetView = Kokkos::View<size_t*, MemSpace>;
+
+  enum Mode { DISABLED = 0, STORE, LOAD };
+
+  ElemGeometryCacheView() = default;
+
+  ElemGeometryCacheView(DataView data, OffsetView bucketOffsets, Mode mode)
+    : data_(data), bucketOffsets_(bucketOffsets), mode_(mode)
+  {
+  }
+
+  KOKKOS_INLINE_FUNCTION bool storing() const { return mode_ == STORE; }
+  KOKKOS_INLINE_FUNCTION bool loading() const { return mode_ == LOAD; }
+
+  //! Save the master element views computed for this SIMD group
+  template <typename ScratchViewsType>
+  KOKKOS_INLINE_FUNCTION void store(
+    const ElemDataRequestsGPU& dataNeeded,
+    const int bucketOrd,
+    const size_t simdGroup,
+    ScratchViewsType& scrViews) const
+  {
+    copy<true>(dataNeeded, bucketOrd, simdGroup, scrViews);
+  }
+
+  //! Fill the master element views of this SIMD group from the cache
+  template <typename ScratchViewsType>
+  KOKKOS_INLINE_FUNCTION void load(
+    const ElemDataRequestsGPU& dataNeeded,
+    const int bucketOrd,
+    const size_t simdGroup,
+    ScratchViewsType& scrViews) const
+  {
+    copy<false>(dataNeeded, bucketOrd, simdGroup, scrViews);
+  }
+
+private:
+  template <bool ToCache, typename ScratchViewsType>
+  KOKKOS_INLINE_FUNCTION void copy(
+    const ElemDataRequestsGPU& dataNeeded,
+    const int bucketOrd,
+    const size_t simdGroup,
+    ScratchViewsType& scrViews) const
+  {
+    const size_t row = bucketOffsets_(bucketOrd) + simdGroup;
+    const auto& data = data_;
+    size_t offset = 0;
+
+    auto copy_view = [&](auto& view) {
+      auto* ptr = view.data();
+      const size_t len = view.size();
+      for (size_t k = 0; k < len; ++k) {
+        if (ToCache)
+          data(row, offset + k) = ptr[k];
+        else
+          ptr[k] = data(row, offset + k);
+      }
+      offset += len;
+    };
+
+    const auto& coordsTypes = dataNeeded.get_coordinates_types();
+    for (unsigned i = 0; i < coordsTypes.size(); ++i) {
+      const auto cType = coordsTypes(i);
+      impl::for_each_geometry_view(
+        dataNeeded.get_data_enums(cType), scrViews.get_me_views(cType),
+        copy_view);
+    }
+  }
+
+  DataView data_;
+  OffsetView bucketOffsets_;
+  Mode mode_{DISABLED};
+};
+
+/** Opt-in per-element cache of the geometric master element data
+ *
+ *  Element algorithms evaluate SCS areas, gradient operators, and volumes
+ *  from the nodal coordinates on every execution. On meshes that do not
+ *  move these never change, so the first execution stores them and later
+ *  executions copy them into the scratch views instead. The cache is rebuilt
+ *  after the mesh is modified or the geometry is updated due to mesh motion.
+ */
+class ElemGeometryCache
+{
+public:
+  ElemGeometryCache(Realm&, const std::string& name);
+
+  //! True if all the master element calls requested can be served
+  static bool is_cacheable(const ElemDataRequests&);
+
+  /** Return a handle for the next execution over the given buckets
+   *
+   *  The handle is in STORE mode when the cache was (re)allocated and has to
+   *  be populated by this execution, and in LOAD mode otherwise.
+   */
+  template <typename BucketIdsType>
+  ElemGeometryCacheView prepare(
+    const ElemDataRequests& dataNeeded,
+    const stk::mesh::EntityRank rank,
+    const BucketIdsType& bucketIds)
+  {
+    if (!is_cacheable(dataNeeded))
+      return ElemGeometryCacheView();
+
+    const auto& buckets = bulk_.buckets(rank);
+    std::vector<size_t> bucketLengths(bucketIds.size());
+    for (size_t i = 0; i < bucketIds.size(); ++i)
+      bucketLengths[i] = buckets[bucketIds[i]]->size();
+
+    return prepare(dataNeeded, bucketLengths);
+  }
+
+  /** Called by every rank after the execution that followed prepare()
+   *
+   *  Reports the global and per-rank maximum memory footprint once the cache
+   *  has been populated for the first time or after a mesh modification.
+   *  This is a collective call.
+   */
+  void populated();
+
+private:
+  ElemGeometryCacheView prepare(
+    const ElemDataRequests& dataNeeded,
+    const std::vector<size_t>& bucketLengths);
+
+  //! Number of cached scalars per SIMD group
+  static size_t num_scalars(const ElemDataRequests&, int nDim);
+
+  const Realm& realm_;
+  const stk::mesh::BulkData& bulk_;
+  const std::string name_;
+
+  ElemGeometryCacheView::DataView data_;
+  ElemGeometryCacheView::OffsetView bucketOffsets_;
+
+  //! Mesh and geometry state that the cached data corresponds to
+  size_t syncCount_{0};
+  size_t geometryVersion_{0};
+  bool isPopulated_{false};
+  bool reportPending_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef EntityMortonSorter_h
+#define EntityMortonSorter_h
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/EntitySorterBase.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace sierra {
+namespace nalu {
+
+/** Interleave the bits of the coordinates scaled to the box [lo, hi]
+ *
+ *  Each direction is quantized to 21 bits, so points close in space get
+ *  keys close in value.
+ */
+uint64_t morton_key(
+  const double* x, const double* lo, const double* hi, const int nDim);
+
+/** Sort nodes, edges and elements along a Morton space-filling curve
+ *
+ *  Elements and edges are ordered by the key of their centroid, so that
+ *  consecutive entities of a bucket touch nodes that are close in memory.
+ *  Sides are left alone, see EntityExposedFaceSorter.
+ */
+class EntityMortonSorter : public stk::mesh::EntitySorterBase
+{
+public:
+  //! The bounding box of the local nodes scales the keys
+  explicit EntityMortonSorter(const stk::mesh::BulkData& bulk);
+
+  virtual void
+  sort(stk::mesh::BulkData& bulk, stk::mesh::EntityVector& entityVector) const;
+
+private:
+  std::array<double, 3> lo_;
+  std::array<double, 3> hi_;
+};
+
+/** Mean spread of the node indices gathered by the entities of a rank
+ *
+ *  Nodes are indexed by their position in the node buckets, as in the NGP
+ *  mesh. The smaller the spread, the better the cache reuse of node data
+ *  gathered by edge and element loops.
+ */
+double mean_node_index_span(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::EntityRank rank,
+  const stk::mesh::Selector& selector);
+
+/** Cache misses of the node data gathered by the entities of a rank
+ *
+ *  Replays the node gathers of an edge or element loop, in bucket order,
+ *  through a least recently used cache of 64 byte lines. Each node holds
+ *  bytesPerNode contiguous bytes at its position in the node buckets. This
+ *  is a hardware independent measure of the effect of the entity order.
+ */
+size_t node_gather_cache_misses(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::EntityRank rank,
+  const stk::mesh::Selector& selector,
+  const size_t bytesPerNode,
+  const size_t cacheBytes);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
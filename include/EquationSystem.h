@@ -299,6 +299,23 @@ public:
   double minLinearIterations_;
   int nonLinearIterationCount_;
   bool reportLinearIterations_;
+
+  //! Linear system timings and iterations accumulated over one time step
+  struct StepStatistics
+  {
+    double assemble{0.0};
+    double loadComplete{0.0};
+    double solve{0.0};
+    double precond{0.0};
+    int linearIterations{0};
+    int linearSolves{0};
+    double maxLinearResidual{0.0};
+  };
+  StepStatistics stepStats_;
+
+  //! Linear solves since the start of the current EquationSystems pass
+  int iterationLinearSolves_{0};
+
   bool firstTimeStepSolve_;
   bool edgeNodalGradient_;
 
@@ -153,6 +153,10 @@ public:
   double provide_system_norm();
   double provide_mean_system_norm();
 
+  //! Max scaled norm over the systems that did a linear solve during the
+  //! last solve_and_update() pass; negative when none did
+  double provide_solved_system_norm() const;
+
   void predict_state();
   void populate_boundary_data();
   void boundary_data_to_state_data();
@@ -0,0 +1,84 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef GEOMETRICWALLDISTANCE_H
+#define GEOMETRICWALLDISTANCE_H
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/FieldBase.hpp"
+#include "stk_mesh/base/Types.hpp"
+#include "stk_search/SearchMethod.hpp"
+
+#include <array>
+
+namespace sierra {
+namespace nalu {
+
+/** Exact minimum distance from the mesh nodes to a set of wall faces
+ *
+ *  The wall faces are inserted into the search tree of an stk coarse search
+ *  as bounding boxes, and every locally owned node queries it with a sphere
+ *  of a bounded radius. The owner of each candidate face sends its vertex
+ *  coordinates once to every rank that owns a matching node, and that rank
+ *  searches a local tree of the received faces to evaluate the exact
+ *  point-to-face distances. Nodes whose closest candidate lies outside the
+ *  search radius are searched again with a larger radius, so faces are only
+ *  exchanged between ranks that are close to each other.
+ *
+ *  Faces are represented by their vertices; quadrilaterals are split into two
+ *  triangles and 2-D faces are line segments.
+ */
+class GeometricWallDistance
+{
+public:
+  //! Maximum number of vertices of a wall face
+  static constexpr int maxFaceVertices = 4;
+
+  using FaceCoords = std::array<double, 3 * maxFaceVertices>;
+
+  GeometricWallDistance(
+    const stk::mesh::BulkData& bulk,
+    const stk::mesh::FieldBase& coordinates,
+    stk::mesh::FieldBase& wallDistance,
+    const stk::mesh::PartVector& wallParts,
+    stk::search::SearchMethod searchMethod = stk::search::KDTREE);
+
+  /** Compute the wall distance at the locally owned nodes on host
+   *
+   *  With warmStart the current values of the wall distance field are used
+   *  to size the initial search radius, which makes recomputation after small
+   *  mesh displacements cheap.
+   */
+  void execute(bool warmStart = false);
+
+  //! Number of search passes used by the last call to execute
+  int num_passes() const { return numPasses_; }
+
+  //! Number of faces received by this rank, summed over the passes
+  size_t num_faces_received() const { return numFacesReceived_; }
+
+  //! Distance from a point to a face with the given vertex coordinates
+  static double distance_to_face(
+    const double* point, const FaceCoords& face, int numVertices, int nDim);
+
+private:
+  const stk::mesh::BulkData& bulk_;
+  const stk::mesh::FieldBase& coordinates_;
+  stk::mesh::FieldBase& wallDistance_;
+  const stk::mesh::PartVector wallParts_;
+  const stk::search::SearchMethod searchMethod_;
+
+  int numPasses_{0};
+  size_t numFacesReceived_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* GEOMETRICWALLDISTANCE_H */
@@ -39,6 +39,9 @@
 #include "overset/OversetInfo.h"
 #include <utils/CreateDeviceExpression.h>
 
+#include <functional>
+#include <memory>
+
 namespace sierra {
 namespace nalu {
 
@@ -369,6 +372,16 @@ public:
       const SharedMemView<const double**, DeviceShmem>& lhs,
       const char* trace_tag);
 
+    //! Sum the diagonal block of a node directly into its owned/shared rows
+    KOKKOS_FUNCTION
+    virtual void sum_into_node_block(
+      const stk::mesh::NgpMesh::ConnectedNodes& node,
+      const SharedMemView<int*, DeviceShmem>& localIds,
+      const SharedMemView<int*, DeviceShmem>& sortPermutation,
+      const SharedMemView<const double*, DeviceShmem>& rhs,
+      const SharedMemView<const double**, DeviceShmem>& lhs,
+      const char* trace_tag);
+
     virtual void free_device_pointer();
 
     virtual sierra::nalu::CoeffApplier* device_pointer();
@@ -460,6 +473,47 @@ public:
   /*                        End of of HypreLinSysCoeffApplier definition */
   /***************************************************************************************************/
 
+  /** Graph data shared between scalar systems with identical connectivity
+   *
+   *  Holds the read-only products of the graph construction: the row maps,
+   *  the shared-row maps, the skipped and periodic row maps and the host
+   *  templates of the index arrays. Every system still owns its values, its
+   *  rhs and the device copies of the index arrays that are handed to hypre.
+   */
+  struct SharedGraph
+  {
+    HypreIntType num_rows_owned_{0};
+    HypreIntType num_nonzeros_owned_{0};
+    HypreIntType num_rows_shared_{0};
+    HypreIntType num_nonzeros_shared_{0};
+    HypreIntType offProcNNZToSend_{0};
+    HypreIntType offProcNNZToRecv_{0};
+    HypreIntType offProcRhsToSend_{0};
+    HypreIntType offProcRhsToRecv_{0};
+
+    UnsignedView mat_row_start_owned_;
+    HypreIntTypeView periodic_bc_rows_owned_;
+    MemoryMap map_shared_;
+    UnsignedView mat_row_start_shared_;
+    UnsignedView rhs_row_start_shared_;
+    PeriodicNodeMap periodic_node_to_hypre_id_;
+    HypreIntTypeUnorderedMap skippedRowsMap_;
+    HypreIntTypeUnorderedMapHost skippedRowsMapHost_;
+
+    HypreIntTypeViewHost row_indices_owned_host_;
+    HypreIntTypeViewHost row_counts_owned_host_;
+    HypreIntTypeViewHost row_indices_shared_host_;
+    HypreIntTypeViewHost row_counts_shared_host_;
+    HypreIntTypeViewHost cols_owned_host_;
+    HypreIntTypeViewHost cols_shared_host_;
+    HypreIntTypeViewHost cols_host_;
+    HypreIntTypeViewHost rows_host_;
+    HypreIntTypeView2DHost rhs_rows_host_;
+  };
+
+  //! The graph this system built or adopted; null when it isn't shared
+  const SharedGraph* shared_graph() const { return sharedGraph_.get(); }
+
   /** Update coefficients of a particular row(s) in the linear system
    *
    *  The core method of this class, it updates the matrix and RHS based on the
@@ -531,6 +585,10 @@ public:
   {
   }
 
+  //! The hypre matrix is estimated from the assembly pattern
+  virtual void
+  memory_usage(std::vector<std::pair<std::string, double>>& entries) const;
+
 protected:
   /** Prepare the instance for system construction
    *
@@ -586,6 +644,35 @@ protected:
   //! Flag indicating whether the linear system has been initialized
   bool matrixStatsDumped_{false};
 
+  /** Record a graph construction call instead of running it
+   *
+   *  The recorded calls are replayed by finalizeLinearSystem unless another
+   *  system with the same signature has already built the graph. Returns
+   *  false, and records nothing, when the call must run right away.
+   */
+  bool
+  defer_graph_build(const std::string& signature, std::function<void()> build);
+
+  //! Key identifying the graph of this system; empty when it can't be shared
+  std::string shared_graph_key() const;
+
+  //! Snapshot the graph built by this system so other systems can adopt it
+  std::shared_ptr<SharedGraph> make_shared_graph() const;
+
+  //! Take the graph of another system and allocate the per-system arrays
+  void adopt_shared_graph(std::shared_ptr<SharedGraph> graph);
+
+  //! Deferred graph construction calls
+  std::vector<std::function<void()>> graphBuilders_;
+  //! Signature of the deferred graph construction calls
+  std::string graphSignature_;
+  //! False once a call that can't be shared (e.g. overset) is recorded
+  bool graphShareable_{true};
+  //! True while the deferred calls are being replayed
+  bool replayingGraph_{false};
+  //! The graph this system built or adopted, if it is shared
+  std::shared_ptr<SharedGraph> sharedGraph_;
+
 private:
   //! HYPRE right hand side data structure
   mutable HYPRE_IJVector rhs_;
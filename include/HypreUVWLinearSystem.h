@@ -136,6 +136,19 @@ public:
       const SharedMemView<const double**, DeviceShmem>& lhs,
       const char* trace_tag);
 
+    //! The segregated rows take the general path of operator()
+    KOKKOS_FUNCTION
+    virtual void sum_into_node_block(
+      const stk::mesh::NgpMesh::ConnectedNodes& node,
+      const SharedMemView<int*, DeviceShmem>& localIds,
+      const SharedMemView<int*, DeviceShmem>& sortPermutation,
+      const SharedMemView<const double*, DeviceShmem>& rhs,
+      const SharedMemView<const double**, DeviceShmem>& lhs,
+      const char* trace_tag)
+    {
+      (*this)(1u, node, localIds, sortPermutation, rhs, lhs, trace_tag);
+    }
+
     virtual void free_device_pointer();
 
     virtual sierra::nalu::CoeffApplier* device_pointer();
@@ -12,6 +12,8 @@
 
 #include "HypreDirectSolver.h"
 
+#include <vector>
+
 namespace sierra {
 namespace nalu {
 
@@ -24,6 +26,23 @@ public:
 
   int solve(int, int&, double&, bool);
 
+  /** Solve all components in lockstep with a restarted GMRES
+   *
+   *  Uses the configured preconditioner, Krylov space, iteration limit and
+   *  tolerances. The components share every global reduction, so one
+   *  Gram-Schmidt sweep costs two all-reduces for all components instead of
+   *  one per basis vector and component.
+   *
+   *  @param numRhs Number of components to solve
+   *  @param numIterations Linear iterations performed, per component
+   *  @param finalResidualNorm Final relative residual norm, per component
+   */
+  int solve_multi_rhs(
+    int numRhs,
+    std::vector<int>& numIterations,
+    std::vector<double>& finalResidualNorm,
+    bool isFinalOuterIter);
+
   //! Return the type of solver instance
   virtual PetraType getType() { return PT_HYPRE_SEGREGATED; }
 
@@ -143,6 +143,19 @@ public:
     return writePreassemblyMatrixFiles_;
   }
 
+  //! Solve the segregated momentum components together; see HypreUVWSolver
+  inline bool multiRhsSolve() const { return multiRhsSolve_; }
+
+  //! Let scalar systems with identical connectivity share one graph
+  inline bool shareGraph() const { return shareGraph_; }
+
+  inline int maxIterations() const { return maxIterations_; }
+
+  inline int kspace() const { return kspace_; }
+
+  //! Absolute convergence tolerance; zero when not provided
+  inline double absoluteTolerance() const { return hasAbsTol_ ? absTol_ : 0.0; }
+
 protected:
   //! List of HYPRE API calls and corresponding arugments to configure solver
   //! and preconditioner after they are created.
@@ -185,6 +198,8 @@ protected:
   bool simpleHypreMatrixAssemble_{false};
   bool dumpHypreMatrixStats_{false};
   bool writePreassemblyMatrixFiles_{false};
+  bool multiRhsSolve_{false};
+  bool shareGraph_{true};
 
 private:
   void boomerAMG_solver_config(const YAML::Node&);
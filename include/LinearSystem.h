@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <string>
+#include <utility>
 
 namespace stk {
 namespace mesh {
@@ -69,6 +70,24 @@ public:
     const SharedMemView<const double**, DeviceShmem>& lhs,
     const char* trace_tag) = 0;
 
+  /** Sum the diagonal block of a single node into the system
+   *
+   *  Node kernels only populate the numDof x numDof block coupling a node to
+   *  itself. Implementations can override this to skip the column sort and
+   *  search of the general path; the default forwards to operator().
+   */
+  KOKKOS_FUNCTION
+  virtual void sum_into_node_block(
+    const stk::mesh::NgpMesh::ConnectedNodes& node,
+    const SharedMemView<int*, DeviceShmem>& localIds,
+    const SharedMemView<int*, DeviceShmem>& sortPermutation,
+    const SharedMemView<const double*, DeviceShmem>& rhs,
+    const SharedMemView<const double**, DeviceShmem>& lhs,
+    const char* trace_tag)
+  {
+    (*this)(1u, node, localIds, sortPermutation, rhs, lhs, trace_tag);
+  }
+
   virtual void free_device_pointer() = 0;
   virtual CoeffApplier* device_pointer() = 0;
 };
@@ -209,6 +228,13 @@ public:
   virtual void
   writeSolutionToFile(const char* filename, bool useOwned = true) = 0;
   virtual unsigned numDof() const { return numDof_; }
+
+  //! Append the bytes held on this rank by the parts of the linear system
+  virtual void
+  memory_usage(std::vector<std::pair<std::string, double>>& /* entries */) const
+  {
+  }
+
   const int& linearSolveIterations() const { return linearSolveIterations_; }
   const double& linearResidual() const { return linearResidual_; }
   const double& nonLinearResidual() const { return nonLinearResidual_; }
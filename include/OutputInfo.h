@@ -52,6 +52,7 @@ public:
   int outputStart_;
   bool outputNodeSet_;
   int serializedIOGroupSize_;
+  std::string promotedOutputFormat_;
   bool hasOutputBlock_;
   bool hasRestartBlock_;
   bool activateRestart_;
@@ -0,0 +1,123 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PERFORMANCELOG_H
+#define PERFORMANCELOG_H
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Per time step performance record written in a machine readable format
+ *
+ *  Each time step produces one record holding the number of nonlinear
+ *  iterations taken, the wall time of the time integrator phases, the linear
+ *  system timings, iterations and residuals of every equation system, and the
+ *  memory high-water mark. An equation system may solve its linear system
+ *  several times per step, so both the final linear residual and the largest
+ *  one over all the solves of the step are recorded. Timings are reported as
+ *  the average and maximum over the ranks along with the load imbalance
+ *  (max/avg).
+ *
+ *  The log is configured in the time integrator section of the input file:
+ *
+ *  ```
+ *  performance_log:
+ *    file_name: performance.jsonl
+ *    format: json   # json (one object per line) or csv
+ *  ```
+ */
+class PerformanceLog
+{
+public:
+  //! Wall time of a named phase of the time step on this rank
+  using PhaseTimes = std::vector<std::pair<std::string, double>>;
+
+  enum class Format { JSON, CSV };
+
+  //! Statistics of one equation system over the current time step
+  struct EquationRecord
+  {
+    std::string realm;
+    std::string name;
+    int linearSolves{0};
+    int linearIterations{0};
+    double linearResidual{0.0};
+    double maxLinearResidual{0.0};
+    double nonlinearResidual{0.0};
+    double scaledNonlinearResidual{0.0};
+    //! Wall times on this rank: assemble, load complete, solve, precond setup
+    double timers[4]{0.0, 0.0, 0.0, 0.0};
+  };
+
+  explicit PerformanceLog(const YAML::Node& node);
+
+  /** Write the record of the current time step
+   *
+   *  Collective over all ranks; resets the per step statistics of the
+   *  equation systems.
+   */
+  void write_step(
+    int timeStepCount,
+    double currentTime,
+    double timeStep,
+    int nonlinearIterations,
+    const PhaseTimes& phases,
+    const std::vector<Realm*>& realms);
+
+  //! Write a record from equation system statistics gathered by the caller
+  void write_step(
+    int timeStepCount,
+    double currentTime,
+    double timeStep,
+    int nonlinearIterations,
+    const PhaseTimes& phases,
+    const std::vector<EquationRecord>& equations);
+
+private:
+  void write_json(
+    int timeStepCount,
+    double currentTime,
+    double timeStep,
+    int nonlinearIterations,
+    const PhaseTimes& phases,
+    const std::vector<EquationRecord>& equations,
+    const std::vector<double>& g_max,
+    const std::vector<double>& g_sum);
+
+  void write_csv(
+    int timeStepCount,
+    double currentTime,
+    double timeStep,
+    int nonlinearIterations,
+    const PhaseTimes& phases,
+    const std::vector<EquationRecord>& equations,
+    const std::vector<double>& g_max,
+    const std::vector<double>& g_sum);
+
+  std::string fileName_{"performance.jsonl"};
+  Format format_{Format::JSON};
+  std::ofstream out_;
+  bool headerWritten_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* PERFORMANCELOG_H */
@@ -26,6 +26,8 @@
 
 #include <ngp_utils/NgpFieldManager.h>
 #include "ngp_utils/NgpMeshInfo.h"
+#include "utils/BalanceWeights.h"
+#include "utils/GlobalReductions.h"
 
 #include "stk_mesh/base/NgpMesh.hpp"
 
@@ -37,6 +39,7 @@
 
 namespace stk {
 namespace mesh {
+class EntitySorterBase;
 class Part;
 }
 namespace io {
@@ -58,6 +61,7 @@ namespace nalu {
 class Algorithm;
 class AlgorithmDriver;
 class AuxFunctionAlgorithm;
+class CompactEdgeConnectivity;
 class GeometryAlgDriver;
 
 class NonConformalManager;
@@ -90,6 +94,7 @@ class BdyLayerStatistics;
 class TensorProductQuadratureRule;
 class LagrangeBasis;
 class PromotedElementIO;
+class PromotedElementBinaryIO;
 
 /** Representation of a computational domain and physics equations solved on
  * this domain.
@@ -122,6 +127,7 @@ public:
 
   bool get_activate_memory_diagnostic();
   void provide_memory_summary();
+  void provide_memory_breakdown();
   std::string convert_bytes(double bytes);
 
   void create_mesh();
@@ -149,6 +155,11 @@ public:
 
   void balance_nodes();
 
+  void reorder_entities();
+
+  // sort again with the registered sorter if the mesh was modified since
+  void restore_entity_order();
+
   void create_output_mesh();
   void create_restart_mesh();
   void input_variables_from_mesh();
@@ -158,6 +169,13 @@ public:
   void augment_restart_variable_list(std::string restartFieldName);
 
   void create_edges();
+
+  // edges stored as arrays instead of STK edge entities
+  bool use_compact_edges() const { return useCompactEdges_; }
+  const CompactEdgeConnectivity&
+  compact_edges(const stk::mesh::PartVector& parts);
+  void require_stk_edges(const std::string& algName) const;
+
   void provide_entity_count();
   void delete_edges();
   void commit();
@@ -380,6 +398,7 @@ public:
   unsigned spatialDimension_;
 
   bool realmUsesEdges_;
+  bool useCompactEdges_{false};
   int solveFrequency_;
   bool isTurbulent_;
   bool needsEnthalpy_;
@@ -391,12 +410,20 @@ public:
   stk::io::StkMeshIoBroker* ioBroker_;
   std::unique_ptr<SideWriterContainer> sideWriters_;
 
+  // fields written to the results and restart databases
+  std::vector<stk::mesh::FieldBase*> outputFields_;
+  std::vector<stk::mesh::FieldBase*> restartFields_;
+
   size_t resultsFileIndex_;
   size_t restartFileIndex_;
 
   // nalu field data
   GlobalIdFieldType* naluGlobalId_;
 
+  // compact edges keyed by the ordinals of the parts they cover
+  std::map<std::vector<unsigned>, std::unique_ptr<CompactEdgeConnectivity>>
+    compactEdges_;
+
   // algorithm drivers managed by region
   std::unique_ptr<GeometryAlgDriver> geometryAlgDriver_;
   unsigned numInitialElements_;
@@ -415,6 +442,9 @@ public:
   double timeStepChangeFactor_;
   int currentNonlinearIteration_;
 
+  // scalar reductions deferred to the next sync point
+  GlobalReductions globalReductions_;
+
   SolutionOptions* solutionOptions_;
   OutputInfo* outputInfo_;
   PostProcessingInfo* postProcessingInfo_;
@@ -498,12 +528,28 @@ public:
 
   std::string rebalanceMethod_;
 
+  // per element cost model used as vertex weights of the rebalance
+  BalanceWeightOptions balanceWeights_;
+
+  // ordering of the entities within buckets; none or morton
+  std::string entityReordering_{"none"};
+
+  // sorter registered by reorder_entities and the mesh state it last sorted
+  std::unique_ptr<stk::mesh::EntitySorterBase> entitySorter_;
+  size_t entitySortCount_{0};
+
   // allow aura to be optional
   bool activateAura_;
 
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
 
+  // store element geometry for reuse by element algorithms
+  bool cacheElemGeometry_{false};
+
+  // incremented whenever the geometry is updated due to mesh motion
+  size_t geometryVersion_{0};
+
   // sometimes restarts can be missing states or dofs
   bool supportInconsistentRestart_;
 
@@ -593,6 +639,7 @@ public:
 
   // tools
   std::unique_ptr<PromotedElementIO> promotionIO_; // mesh outputer
+  std::unique_ptr<PromotedElementBinaryIO> promotionBinaryIO_;
   std::vector<std::string> superTargetNames_;
 
   void setup_element_promotion(); // create super parts
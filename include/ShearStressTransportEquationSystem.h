@@ -14,6 +14,10 @@
 #include <FieldTypeDef.h>
 #include <NaluParsedTypes.h>
 
+#include "ngp_algorithms/MultiFieldNodalGradAlgDriver.h"
+
+#include <memory>
+
 namespace stk {
 struct topology;
 namespace mesh {
@@ -57,6 +61,7 @@ public:
   void post_iter_work() final;
   void pre_iter_work() final;
 
+  void assemble_nodal_gradients();
   void clip_min_distance_to_wall();
   void compute_f_one_blending();
   void update_and_clip();
@@ -85,6 +90,9 @@ public:
   bool isInit_;
   AlgorithmDriver* sstMaxLengthScaleAlgDriver_;
 
+  //! Fused edge-based gradients of tke and sdr (null when not applicable)
+  std::unique_ptr<MultiFieldNodalGradAlgDriver> nodalGradAlgDriver_;
+
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part*> wallBcPart_;
 
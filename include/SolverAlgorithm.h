@@ -49,6 +49,16 @@ struct NGPApplyCoeff
     SharedMemView<double**, DeviceShmem>& lhs,
     const char* trace_tag) const;
 
+  //! Apply the diagonal block of a single node, see CoeffApplier
+  KOKKOS_FUNCTION
+  void sum_into_node_block(
+    const stk::mesh::NgpMesh::ConnectedNodes& node,
+    const SharedMemView<int*, DeviceShmem>& scratchIds,
+    const SharedMemView<int*, DeviceShmem>& sortPermutation,
+    SharedMemView<double*, DeviceShmem>& rhs,
+    SharedMemView<double**, DeviceShmem>& lhs,
+    const char* trace_tag) const;
+
   KOKKOS_FUNCTION
   void extract_diagonal(
     const unsigned nEntities,
@@ -84,6 +84,8 @@ public:
   ScalarFieldType* assembledWallArea_;
 
   ScalarNodalGradAlgDriver nodalGradAlgDriver_;
+  //! Interior gradient contribution is assembled by a parent system
+  bool fusedNodalGrad_{false};
   std::unique_ptr<Algorithm> effDiffFluxAlg_;
   std::unique_ptr<NgpAlgDriver> wallModelAlgDriver_;
 };
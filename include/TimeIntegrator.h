@@ -25,6 +25,7 @@ namespace nalu {
 class Realm;
 class Simulation;
 class ExtOverset;
+class PerformanceLog;
 
 class TimeIntegrator
 {
@@ -49,6 +50,7 @@ public:
   void pre_realm_advance_stage2(size_t inonlin = 0);
   void post_realm_advance();
   void interstep_updates(int nonLinearIterationIndex);
+  bool nonlinear_iterations_converged(int iterationsTaken) const;
 
   Simulation* sim_{nullptr};
 
@@ -67,6 +69,12 @@ public:
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
 
+  //! Picard loop exits once the max scaled norm drops below the tolerance;
+  //! disabled when not positive
+  double nonlinearTolerance_{-1.0};
+  int minNonlinearIterations_{2};
+  int nonlinearIterationsTaken_{0};
+
   std::string name_;
 
   std::vector<std::string> realmNamesVec_;
@@ -88,6 +96,9 @@ public:
   void compute_gamma();
 
   std::unique_ptr<ExtOverset> overset_;
+
+  //! Optional per time step performance record
+  std::unique_ptr<PerformanceLog> perfLog_;
 };
 
 } // namespace nalu
@@ -143,6 +143,8 @@ public:
   void writeToFile(const char* filename, bool useOwned = true) override;
   void printInfo(bool useOwned = true);
   void writeSolutionToFile(const char* filename, bool useOwned = true) override;
+  void memory_usage(
+    std::vector<std::pair<std::string, double>>& entries) const override;
   size_t lookup_myLID(
     MyLIDMapType& myLIDs,
     stk::mesh::EntityId entityId,
@@ -253,6 +255,15 @@ public:
       const SharedMemView<const double**, DeviceShmem>& lhs,
       const char* trace_tag);
 
+    KOKKOS_FUNCTION
+    virtual void sum_into_node_block(
+      const stk::mesh::NgpMesh::ConnectedNodes& node,
+      const SharedMemView<int*, DeviceShmem>& localIds,
+      const SharedMemView<int*, DeviceShmem>& sortPermutation,
+      const SharedMemView<const double*, DeviceShmem>& rhs,
+      const SharedMemView<const double**, DeviceShmem>& lhs,
+      const char* trace_tag);
+
     void free_device_pointer() {};
 
     sierra::nalu::CoeffApplier* device_pointer() { return nullptr; };
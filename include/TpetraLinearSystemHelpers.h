@@ -127,6 +127,15 @@ void fill_in_extra_dof_rows_per_node(LocalGraphArrays& csg, int numDof);
 void remove_invalid_indices(
   LocalGraphArrays& csg, LinSys::HostRowLengths& rowLengths);
 
+//! Bytes of the local structure of a graph; zero if it is not allocated
+double local_memory_bytes(const Teuchos::RCP<LinSys::Graph>& graph);
+
+//! Bytes of the local values of a matrix; its structure belongs to the graph
+double local_memory_bytes(const Teuchos::RCP<LinSys::Matrix>& matrix);
+
+//! Bytes of the local entries of a multivector
+double local_memory_bytes(const Teuchos::RCP<LinSys::MultiVector>& vec);
+
 template <typename ViewType>
 void
 sync_dual_view_host_to_device(ViewType viewToSync)
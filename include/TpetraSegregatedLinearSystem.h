@@ -138,6 +138,8 @@ public:
   void writeToFile(const char* filename, bool useOwned = true);
   void printInfo(bool useOwned = true);
   void writeSolutionToFile(const char* filename, bool useOwned = true);
+  void memory_usage(
+    std::vector<std::pair<std::string, double>>& entries) const override;
   size_t lookup_myLID(
     MyLIDMapType& myLIDs,
     stk::mesh::EntityId entityId,
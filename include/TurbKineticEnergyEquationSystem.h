@@ -94,6 +94,8 @@ public:
   ScalarFieldType* evisc_;
 
   ScalarNodalGradAlgDriver nodalGradAlgDriver_;
+  //! Interior gradient contribution is assembled by a parent system
+  bool fusedNodalGrad_{false};
   std::unique_ptr<TKEWallFuncAlgDriver> wallFuncAlgDriver_;
   std::unique_ptr<Algorithm> effDiffFluxCoeffAlg_;
   const TurbulenceModel turbulenceModel_;
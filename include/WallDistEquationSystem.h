@@ -21,6 +21,7 @@ namespace nalu {
 
 class Realm;
 class EquationSystems;
+class GeometricWallDistance;
 
 class WallDistEquationSystem : public EquationSystem
 {
@@ -70,7 +71,13 @@ public:
 
   void compute_wall_distance();
 
+  //! Compute the exact distance to the wall faces instead of solving for it
+  void compute_geometric_wall_distance();
+
 private:
+  //! Update shared, ghosted, periodic, and overset wall distance values
+  void communicate_wall_distance();
+
   WallDistEquationSystem() = delete;
   WallDistEquationSystem(const WallDistEquationSystem&) = delete;
 
@@ -94,6 +101,20 @@ private:
 
   //! User option to force recomputation of wall distance on restart
   bool forceInitOnRestart_{false};
+
+  //! Use the exact geometric distance rather than the Poisson solution
+  bool geometricDistance_{false};
+
+  //! Wall parts the distance is measured from (ABL wall function walls
+  //! are excluded as they do not get a Dirichlet condition either)
+  stk::mesh::PartVector wallParts_;
+
+  std::unique_ptr<GeometricWallDistance> geometricWallDist_;
+
+  //! Mesh and geometry state of the last geometric wall distance
+  bool hasGeometricDistance_{false};
+  size_t syncCount_{0};
+  size_t geometryVersion_{0};
 };
 
 } // namespace nalu
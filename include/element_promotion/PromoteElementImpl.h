@@ -93,6 +93,38 @@ using NodesElemMap = std::unordered_map<
   stk::mesh::Entity,
   EntityIdVectorHash>;
 
+/** First ids of the entities created by promotion
+ *
+ *  New nodes are numbered from the id of the edge, face or element they are
+ *  placed on, and each parent rank gets its own block of ids past the largest
+ *  existing node id. Super elements and super sides are numbered from the
+ *  base element and base side they replace. Every process therefore assigns
+ *  the same id to a shared node without communicating, and the ids do not
+ *  depend on the decomposition.
+ */
+struct PromotedIdOffsets
+{
+  stk::mesh::EntityId edgeNode{0};
+  stk::mesh::EntityId faceNode{0};
+  stk::mesh::EntityId volumeNode{0};
+  stk::mesh::EntityId elem{0};
+  stk::mesh::EntityId side{0};
+};
+
+PromotedIdOffsets promoted_id_offsets(
+  const stk::mesh::BulkData& bulk, const HexNElementDescription& desc);
+
+//! Id of the k-th of numNewNodes entities created from parent parentId
+inline stk::mesh::EntityId
+promoted_entity_id(
+  stk::mesh::EntityId offset,
+  stk::mesh::EntityId parentId,
+  int numNewNodes,
+  int k)
+{
+  return offset + (parentId - 1) * numNewNodes + k + 1;
+}
+
 std::pair<stk::mesh::PartVector, stk::mesh::PartVector> promote_elements_hex(
   std::vector<double> nodeLocs1D,
   stk::mesh::BulkData& bulk,
@@ -103,7 +135,8 @@ ConnectivityMap connectivity_map_for_parent_rank(
   stk::mesh::BulkData& bulk,
   const int numNewNodesOnTopo,
   const stk::mesh::Selector& selector,
-  stk::topology::rank_t parent_rank);
+  stk::topology::rank_t parent_rank,
+  stk::mesh::EntityId idOffset);
 
 void add_base_nodes_to_elem_connectivity(
   const stk::mesh::BulkData& bulk,
@@ -141,7 +174,8 @@ stk::mesh::PartVector create_super_elements(
   const stk::mesh::PartVector& partsToBePromoted,
   const ConnectivityMap& edgeConnectivity,
   const ConnectivityMap& faceConnectivity,
-  const ConnectivityMap& volumeConnectivity);
+  const ConnectivityMap& volumeConnectivity,
+  stk::mesh::EntityId elemIdOffset);
 
 void set_coordinates_hex(
   std::vector<double> nodeLocs1D,
@@ -150,9 +184,6 @@ void set_coordinates_hex(
   const stk::mesh::PartVector& partsToBePromoted,
   const VectorFieldType& coordField);
 
-void perform_parallel_consolidation_of_node_ids(
-  const stk::mesh::BulkData& bulk, ConnectivityMap& connectivityMap);
-
 void destroy_entities(
   stk::mesh::BulkData& bulk,
   const stk::mesh::Selector& selector,
@@ -172,6 +203,12 @@ exposed_side_to_super_elem_map(
 stk::mesh::PartVector create_boundary_elements(
   int p, stk::mesh::BulkData& bulk, const stk::mesh::PartVector& parts);
 
+stk::mesh::PartVector create_boundary_elements_for_super_elements(
+  stk::mesh::BulkData& bulk,
+  const HexNElementDescription& desc,
+  const stk::mesh::PartVector& parts,
+  const PromotedIdOffsets& offsets);
+
 } // namespace impl
 } // namespace nalu
 } // namespace sierra
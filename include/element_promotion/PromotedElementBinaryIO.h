@@ -0,0 +1,126 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PromotedElementBinaryIO_h
+#define PromotedElementBinaryIO_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <element_promotion/HexNElementDescription.h>
+#include <FieldTypeDef.h>
+
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+class MetaData;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Write promoted element results in their native high-order form
+ *
+ *  Instead of subdividing the super elements into linear sub-elements, each
+ *  process writes its nodes, its owned super elements and the tensor-product
+ *  node map of the element description to the file
+ *  "<fileName>.<numProcs>.<rank>". Subdividing for visualization is left to
+ *  post-processing. The layout, in host byte order, is
+ *
+ *    char[8]  magic "NALUHO01"
+ *    int32    polynomial order, dimension, nodes per element
+ *    int32    node map (element node ordinal of tensor-product index
+ *             i + n1D * (j + n1D * k)), nodes per element entries
+ *    int64    number of nodes
+ *    int64    node ids
+ *    double   node coordinates, interleaved
+ *    int32    number of element blocks, then for each block:
+ *               int32 name length, char name, int64 number of elements,
+ *               int64 element ids, int32 connectivity as local node indices
+ *    int32    number of fields, then for each field:
+ *               int32 name length, char name, int32 components
+ *
+ *  followed by one record per output step: the time as a double and then,
+ *  field by field, the nodal values as doubles interleaved by component.
+ *
+ *  The field values are copied into a staging buffer on the calling thread
+ *  and written on a background thread; a write waits for the previous one.
+ */
+class PromotedElementBinaryIO
+{
+public:
+  PromotedElementBinaryIO(
+    int p,
+    const stk::mesh::MetaData& metaData,
+    const stk::mesh::BulkData& bulkData,
+    const stk::mesh::PartVector& baseParts,
+    const std::string& fileName,
+    const VectorFieldType& coordField);
+
+  ~PromotedElementBinaryIO();
+
+  PromotedElementBinaryIO(const PromotedElementBinaryIO&) = delete;
+  PromotedElementBinaryIO& operator=(const PromotedElementBinaryIO&) = delete;
+
+  //! Register the output fields; must be called before the first write
+  void add_fields(const std::vector<stk::mesh::FieldBase*>& fields);
+
+  std::map<const std::string, const stk::mesh::FieldBase*>
+  get_output_fields() const
+  {
+    return fields_;
+  }
+
+  //! Snapshot the output fields and start appending them at currentTime
+  void write_database_data(double currentTime);
+
+  //! Block until the pending write, if any, has completed
+  void wait();
+
+  static std::string
+  file_name(const std::string& baseName, int numProcs, int rank)
+  {
+    return baseName + "." + std::to_string(numProcs) + "." +
+           std::to_string(rank);
+  }
+
+private:
+  void write_mesh(const VectorFieldType& coordField);
+  void write_field_definitions();
+
+  const HexNElementDescription elem_;
+  const stk::mesh::MetaData& metaData_;
+  const stk::mesh::BulkData& bulkData_;
+  const unsigned nDim_;
+  stk::mesh::PartVector superElemParts_;
+
+  //! Nodes in file order
+  std::vector<stk::mesh::Entity> nodes_;
+
+  std::map<const std::string, const stk::mesh::FieldBase*> fields_;
+  bool fieldsDefined_{false};
+
+  std::ofstream file_;
+  std::vector<double> stagingBuffer_;
+  std::future<void> pending_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
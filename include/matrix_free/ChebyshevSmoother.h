@@ -0,0 +1,97 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CHEBYSHEV_SMOOTHER_H
+#define CHEBYSHEV_SMOOTHER_H
+
+#include "Teuchos_BLAS_types.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_Map.hpp"
+#include "Tpetra_MultiVector.hpp"
+#include "Tpetra_Operator.hpp"
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+struct ChebyshevOptions
+{
+  ChebyshevOptions() = default;
+  explicit ChebyshevOptions(const Teuchos::ParameterList&);
+
+  int degree{2};
+  int eigenvalue_iterations{10};
+  double eigenvalue_ratio{30};
+  double eigenvalue_boost{1.1};
+};
+
+// Chebyshev-accelerated Jacobi iteration for a linear operator with a known
+// diagonal.  After the eigenvalue estimate, each application costs "degree"
+// operator applications and no global reductions
+class ChebyshevSmoother final : public Tpetra::Operator<>
+{
+public:
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using base_operator_type = Tpetra::Operator<>;
+
+  ChebyshevSmoother(
+    Teuchos::RCP<const map_type> owned_map,
+    int num_vectors,
+    ChebyshevOptions options = {});
+
+  // approximately solves A y = x from a zero initial guess
+  void apply(
+    const mv_type& x,
+    mv_type& y,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  // improves x as a solution to A x = b
+  void smooth(const mv_type& b, mv_type& x, bool zero_initial_guess) const;
+
+  void set_linear_operator(Teuchos::RCP<const base_operator_type> op)
+  {
+    op_ = op;
+  }
+
+  // inverse of the operator's diagonal, stored in the first column
+  mv_type& get_inverse_diagonal() { return inverse_diagonal_; }
+
+  // power iteration for the largest eigenvalue of D^-1 A.  Requires the
+  // linear operator and the inverse diagonal to be set
+  void compute_eigenvalue_estimate();
+  double max_eigenvalue() const { return lambda_max_; }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  const Teuchos::RCP<const map_type> map_;
+  const ChebyshevOptions options_;
+
+  Teuchos::RCP<const base_operator_type> op_;
+
+  mv_type inverse_diagonal_;
+  mutable mv_type ax_;
+  mutable mv_type search_direction_;
+
+  double lambda_max_{-1};
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
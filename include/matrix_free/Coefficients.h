@@ -273,6 +273,589 @@ struct Coeffs<4>
      0.52115526800919631042, 0.13886368840594742478}};
 };
 
+template <>
+struct Coeffs<5>
+{
+  using nodal_matrix_type = ArrayND<double[6][6]>;
+  using scs_matrix_type = ArrayND<double[5][6]>;
+  using linear_nodal_matrix_type = ArrayND<double[2][6]>;
+  using linear_scs_matrix_type = ArrayND<double[2][5]>;
+
+  static constexpr nodal_matrix_type W = {
+    {{0.06530146967169493327851, 0.03627793331600713147528,
+      -0.01165735168296851502133, 0.0062335419714341427523,
+      -0.003700636209803418670536, 0.00136519699497173338816},
+     {0.003279090834936608065758, 0.320303343905857687781,
+      0.05602605871092387106068, -0.01787304014973326103167,
+      0.009254173365932603951313, -0.003279090834936608065758},
+     {-0.003997227173298208010931, 0.02965484863437086536049,
+      0.4715864922338789980228, 0.05054267595195111723396,
+      -0.01331470671451788958092, 0.003997227173298208010931},
+     {0.003997227173298208010931, -0.01331470671451788958092,
+      0.05054267595195111723396, 0.4715864922338789980228,
+      0.02965484863437086536049, -0.003997227173298208010931},
+     {-0.003279090834936608065758, 0.009254173365932603951313,
+      -0.01787304014973326103167, 0.05602605871092387106068,
+      0.320303343905857687781, 0.003279090834936608065758},
+     {0.00136519699497173338816, -0.003700636209803418670536,
+      0.0062335419714341427523, -0.01165735168296851502133,
+      0.03627793331600713147528, 0.06530146967169493327851}}};
+
+  static constexpr nodal_matrix_type D = {
+    {{-7.5, 10.14141593631966928023, -4.036187270305348005275,
+      2.244684648176166824271, -1.349913314190488099231, 0.5},
+     {-1.786364948339094893972, 0, 2.523426777429455431909,
+      -1.152828158535929341332, 0.6535475074298001672007,
+      -0.2377811779842313638053},
+     {0.484951047853569169306, -1.721256952830233383216, 0,
+      1.752961966367865978878, -0.7863566722232407374395,
+      0.2697006108320389724721},
+     {-0.2697006108320389724721, 0.7863566722232407374395,
+      -1.752961966367865978878, 0, 1.721256952830233383216,
+      -0.484951047853569169306},
+     {0.2377811779842313638053, -0.6535475074298001672007,
+      1.152828158535929341332, -2.523426777429455431909, 0,
+      1.786364948339094893972},
+     {-0.5, 1.349913314190488099231, -2.244684648176166824271,
+      4.036187270305348005275, -10.14141593631966928023, 7.5}}};
+
+  static constexpr scs_matrix_type Nt = {
+    {{0.4365363738624496765746, 0.6914778893211668643913,
+      -0.190282048616903449221, 0.09917256452430220669719,
+      -0.05839063727822323222978, 0.02148585818720793378765},
+     {-0.1244051944023349039115, 0.6037681555875741277559,
+      0.6541047177124134806413, -0.2010973282614030882103,
+      0.1049503907147767938792, -0.03732074135102641015451},
+     {0.0625, -0.1946486423538422797659, 0.6321486423538422797659,
+      0.6321486423538422797659, -0.1946486423538422797659, 0.0625},
+     {-0.03732074135102641015451, 0.1049503907147767938792,
+      -0.2010973282614030882103, 0.6541047177124134806413,
+      0.6037681555875741277559, -0.1244051944023349039115},
+     {0.02148585818720793378765, -0.05839063727822323222978,
+      0.09917256452430220669719, -0.190282048616903449221,
+      0.6914778893211668643913, 0.4365363738624496765746}}};
+
+  static constexpr scs_matrix_type Dt = {
+    {{-4.652906171706550280389, 4.899771347151789808004,
+      -0.3064378138886160685086, 0.08323956582294126230929,
+      -0.0349386120702753239241, 0.01127168469071060250892},
+     {0.2695491266914919326521, -2.664631172059592189352,
+      2.582966421990422763658, -0.2441387962360227502689,
+      0.08051277894909882318688, -0.02425835933539857987579},
+     {-0.0625, 0.2544242700698965056825, -2.216265054274736419016,
+      2.216265054274736419016, -0.2544242700698965056825, 0.0625},
+     {0.02425835933539857987579, -0.08051277894909882318688,
+      0.2441387962360227502689, -2.582966421990422763658,
+      2.664631172059592189352, -0.2695491266914919326521},
+     {-0.01127168469071060250892, 0.0349386120702753239241,
+      -0.08323956582294126230929, 0.3064378138886160685086,
+      -4.899771347151789808004, 4.652906171706550280389}}};
+
+  static constexpr linear_nodal_matrix_type Nlin = {
+    {{1, 0.8825276619647323464255, 0.6426157582403225481571,
+      0.3573842417596774518429, 0.1174723380352676535745, 0},
+     {0, 0.1174723380352676535745, 0.3573842417596774518429,
+      0.6426157582403225481571, 0.8825276619647323464255, 1}}};
+
+  static constexpr linear_scs_matrix_type Ntlin = {
+    {{0.9530899229693319963988, 0.7692346550528415455182, 0.5,
+      0.2307653449471584544818, 0.04691007703066800360119},
+     {0.04691007703066800360119, 0.2307653449471584544818, 0.5,
+      0.7692346550528415455182, 0.9530899229693319963988}}};
+
+  static constexpr ArrayND<double[6]> Wl = {
+    {0.09382015406133600720237, 0.3677105358329809017613,
+     0.5384693101056830910363, 0.5384693101056830910363,
+     0.3677105358329809017613, 0.09382015406133600720237}};
+};
+
+template <>
+struct Coeffs<6>
+{
+  using nodal_matrix_type = ArrayND<double[7][7]>;
+  using scs_matrix_type = ArrayND<double[6][7]>;
+  using linear_nodal_matrix_type = ArrayND<double[2][7]>;
+  using linear_scs_matrix_type = ArrayND<double[2][6]>;
+
+  static constexpr nodal_matrix_type W = {
+    {{0.04691934588074958312092, 0.02621654262165761189708,
+      -0.008438249578501895588024, 0.004576495962251174401537,
+      -0.002891156960584075066189, 0.001847209609573609349072,
+      -6.997017382980359266988e-4},
+     {0.001701047707432176717778, 0.2358537438120853115922,
+      0.04285432067539823072843, -0.01385003258629831425646,
+      0.007576151254784671380056, -0.004576150833946738728835,
+      0.001701047707432176717778},
+     {-0.002139505903627476844507, 0.01943221647137440552377,
+      0.3695122791780618761209, 0.04425834084713792603481,
+      -0.01247300812777705048595, 0.006139383821525401526424,
+      -0.002139505903627476844507},
+     {0.002276319868986672106855, -0.008086898140703653148963,
+      0.03560504476848086632868, 0.4176494391728660466879,
+      0.03560504476848086632868, -0.008086898140703653148963,
+      0.002276319868986672106855},
+     {-0.002139505903627476844507, 0.006139383821525401526424,
+      -0.01247300812777705048595, 0.04425834084713792603481,
+      0.3695122791780618761209, 0.01943221647137440552377,
+      -0.002139505903627476844507},
+     {0.001701047707432176717778, -0.004576150833946738728835,
+      0.007576151254784671380056, -0.01385003258629831425646,
+      0.04285432067539823072843, 0.2358537438120853115922,
+      0.001701047707432176717778},
+     {-6.997017382980359266988e-4, 0.001847209609573609349072,
+      -0.002891156960584075066189, 0.004576495962251174401537,
+      -0.008438249578501895588024, 0.02621654262165761189708,
+      0.04691934588074958312092}}};
+
+  static constexpr nodal_matrix_type D = {
+    {{-10.5, 14.20157660291981616708, -5.668985225545507878575, 3.2,
+      -2.049964813076742776962, 1.317373435702434488456, -0.5},
+     {-2.442926014244289612644, 0, 3.455828214294285132601,
+      -1.598606688098366837168, 0.9613397972887116667113,
+      -0.6022471796357856846664, 0.2266118703954453351652},
+     {0.6252566655153421142548, -2.215804283169971313638, 0,
+      2.266698087085999012208, -1.066441904006374689736,
+      0.6163908355175795286461, -0.2260994009425746517358},
+     {-0.3125, 0.9075444712688209188203, -2.006969240588753089572, 0,
+      2.006969240588753089572, -0.9075444712688209188203, 0.3125},
+     {0.2260994009425746517358, -0.6163908355175795286461,
+      1.066441904006374689736, -2.266698087085999012208, 0,
+      2.215804283169971313638, -0.6252566655153421142548},
+     {-0.2266118703954453351652, 0.6022471796357856846664,
+      -0.9613397972887116667113, 1.598606688098366837168,
+      -3.455828214294285132601, 0, 2.442926014244289612644},
+     {0.5, -1.317373435702434488456, 2.049964813076742776962, -3.2,
+      5.668985225545507878575, -14.20157660291981616708, 10.5}}};
+
+  static constexpr scs_matrix_type Nt = {
+    {{0.4351734281450880317825, 0.6929958957662397360849,
+      -0.1908635085315759876631, 0.1008503894174153852632,
+      -0.06314645066888346283078, 0.04019745757287234107353,
+      -0.01520721170115604371024},
+     {-0.1241372370531926887656, 0.599960388085173697732,
+      0.658325737871498741111, -0.2035374890409166302753,
+      0.1120614244199860197272, -0.06798963927665222533662,
+      0.0253168149941030858073},
+     {0.06278424196534005266672, -0.1948202445054070876436,
+      0.6251941541027388521888, 0.6410578198124032520959,
+      -0.2034554337438759609226, 0.1078330170188652656411,
+      -0.03859355465006437402627},
+     {-0.03859355465006437402627, 0.1078330170188652656411,
+      -0.2034554337438759609226, 0.6410578198124032520959,
+      0.6251941541027388521888, -0.1948202445054070876436,
+      0.06278424196534005266672},
+     {0.0253168149941030858073, -0.06798963927665222533662,
+      0.1120614244199860197272, -0.2035374890409166302753,
+      0.658325737871498741111, 0.599960388085173697732,
+      -0.1241372370531926887656},
+     {-0.01520721170115604371024, 0.04019745757287234107353,
+      -0.06314645066888346283078, 0.1008503894174153852632,
+      -0.1908635085315759876631, 0.6929958957662397360849,
+      0.4351734281450880317825}}};
+
+  static constexpr scs_matrix_type Dt = {
+    {{-6.444103326225442682838, 6.777756444069647801426,
+      -0.4116802808771052826696, 0.1081540874862785734721,
+      -0.0450621748985097533539, 0.0228045656345234475493,
+      -0.007869315189392103585868},
+     {0.3664128582500753752193, -3.54975669693362098193,
+      3.422352403991222792136, -0.3078260732635580825417,
+      0.09916429650218140085741, -0.04558677888126795806374,
+      0.0152399903349674543228},
+     {-0.08246102451985420660898, 0.3293081362402779891177,
+      -2.715524563486858973853, 2.686530912853303360134,
+      -0.2875825332365760643777, 0.100887603426868396916,
+      -0.03115853127716050132824},
+     {0.03115853127716050132824, -0.100887603426868396916,
+      0.2875825332365760643777, -2.686530912853303360134,
+      2.715524563486858973853, -0.3293081362402779891177,
+      0.08246102451985420660898},
+     {-0.0152399903349674543228, 0.04558677888126795806374,
+      -0.09916429650218140085741, 0.3078260732635580825417,
+      -3.422352403991222792136, 3.54975669693362098193,
+      -0.3664128582500753752193},
+     {0.007869315189392103585868, -0.0228045656345234475493,
+      0.0450621748985097533539, -0.1081540874862785734721,
+      0.4116802808771052826696, -6.777756444069647801426,
+      6.444103326225442682838}}};
+
+  static constexpr linear_nodal_matrix_type Nlin = {
+    {{1, 0.915111948139283464936, 0.7344243967353571069019, 0.5,
+      0.2655756032646428930981, 0.08488805186071653506398, 0},
+     {0, 0.08488805186071653506398, 0.2655756032646428930981, 0.5,
+      0.7344243967353571069019, 0.915111948139283464936, 1}}};
+
+  static constexpr linear_scs_matrix_type Ntlin = {
+    {{0.9662347571015760139062, 0.8306046932331322568307,
+      0.6193095930415984543153, 0.3806904069584015456847,
+      0.1693953067668677431693, 0.03376524289842398609385},
+     {0.03376524289842398609385, 0.1693953067668677431693,
+      0.3806904069584015456847, 0.6193095930415984543153,
+      0.8306046932331322568307, 0.9662347571015760139062}}};
+
+  static constexpr ArrayND<double[7]> Wl = {
+    {0.0675304857968479721877, 0.2712601277368875141509,
+     0.4225902003830676050309, 0.477238372166393817261,
+     0.4225902003830676050309, 0.2712601277368875141509,
+     0.0675304857968479721877}};
+};
+
+template <>
+struct Coeffs<7>
+{
+  using nodal_matrix_type = ArrayND<double[8][8]>;
+  using scs_matrix_type = ArrayND<double[7][8]>;
+  using linear_nodal_matrix_type = ArrayND<double[2][8]>;
+  using linear_scs_matrix_type = ArrayND<double[2][7]>;
+
+  static constexpr nodal_matrix_type W = {
+    {{0.03531958097096668159491, 0.01980588143578508502761,
+      -0.006378158589536865797982, 0.003478446207504025235882,
+      -0.002241931835495010516882, 0.00153909833068617570819,
+      -0.001025533605987648468718, 3.947047433190326908014e-4},
+     {9.667866706919865510521e-4, 0.1802717138663200758012,
+      0.03351167367710492062977, -0.010892517319710646513,
+      0.006064592623702207586763, -0.003916055644048949700408,
+      0.002537319539996476858016, -9.667866706919865510521e-4},
+     {-0.001239076742316695268633, 0.01366463736920594769606,
+      0.2932087122506631953938, 0.03732926740823916845146,
+      -0.01082111892371634579354, 0.005658895305186290599258,
+      -0.003354359187580983389775, 0.001239076742316695268633},
+     {0.001364539457800884265525, -0.005209483060903790413973,
+      0.02619357555078908886335, 0.3548838677770095044327,
+      0.03465818872117097868369, -0.008695048397339490931731,
+      0.004014050786670876272589, -0.001364539457800884265525},
+     {-0.001364539457800884265525, 0.004014050786670876272589,
+      -0.008695048397339490931731, 0.03465818872117097868369,
+      0.3548838677770095044327, 0.02619357555078908886335,
+      -0.005209483060903790413973, 0.001364539457800884265525},
+     {0.001239076742316695268633, -0.003354359187580983389775,
+      0.005658895305186290599258, -0.01082111892371634579354,
+      0.03732926740823916845146, 0.2932087122506631953938,
+      0.01366463736920594769606, -0.001239076742316695268633},
+     {-9.667866706919865510521e-4, 0.002537319539996476858016,
+      -0.003916055644048949700408, 0.006064592623702207586763,
+      -0.010892517319710646513, 0.03351167367710492062977,
+      0.1802717138663200758012, 9.667866706919865510521e-4},
+     {3.947047433190326908014e-4, -0.001025533605987648468718,
+      0.00153909833068617570819, -0.002241931835495010516882,
+      0.003478446207504025235882, -0.006378158589536865797982,
+      0.01980588143578508502761, 0.03531958097096668159491}}};
+
+  static constexpr nodal_matrix_type D = {
+    {{-14, 18.93759860711737051315, -7.569289819348487008798,
+      4.297908164265175214249, -2.810188989257949038538,
+      1.941659425544122302329, -1.297687388320231982397, 0.5},
+     {-3.209915703002990336815, 0, 4.543585064566564217396,
+      -2.112061214314542228393, 1.294232050913501507693,
+      -0.8694480983314929341612, 0.57356541494026413731,
+      -0.21995751477130436303},
+     {0.7924766813205145268014, -2.806475794736433436471, 0,
+      2.875517405972505217474, -1.37278583180602848091,
+      0.8450225565065104898299, -0.5370395861576610609376,
+      0.2032845689005927442141},
+     {-0.3721504357285948658471, 1.078944688790452702508,
+      -2.37818723351550582457, 0, 2.38892435915823921488,
+      -1.135358016881111440465, 0.6611573509003112232014,
+      -0.2433307127237910097078},
+     {0.2433307127237910097078, -0.6611573509003112232014,
+      1.135358016881111440465, -2.38892435915823921488, 0,
+      2.37818723351550582457, -1.078944688790452702508,
+      0.3721504357285948658471},
+     {-0.2032845689005927442141, 0.5370395861576610609376,
+      -0.8450225565065104898299, 1.37278583180602848091,
+      -2.875517405972505217474, 0, 2.806475794736433436471,
+      -0.7924766813205145268014},
+     {0.21995751477130436303, -0.57356541494026413731, 0.8694480983314929341612,
+      -1.294232050913501507693, 2.112061214314542228393,
+      -4.543585064566564217396, 0, 3.209915703002990336815},
+     {-0.5, 1.297687388320231982397, -1.941659425544122302329,
+      2.810188989257949038538, -4.297908164265175214249,
+      7.569289819348487008798, -18.93759860711737051315, 14}}};
+
+  static constexpr scs_matrix_type Nt = {
+    {{0.4343202773431659577188, 0.6939304865766944381799,
+      -0.1911308324656548154047, 0.1015337067167920367718,
+      -0.06484379890853231006886, 0.04433494178435378867429,
+      -0.02948507959360312159186, 0.01134029854678402572063},
+     {-0.1239475950210044312856, 0.5976143472590356184775,
+      0.660813468654549139196, -0.2045571191722765042772,
+      0.114501847692819048533, -0.07426343845739941112028,
+      0.04823413317502414426652, -0.01839564413074760379003},
+     {0.06286527783698134326236, -0.1947323378660034080706,
+      0.6211128101503285960334, 0.6458262927229572593084,
+      -0.2063491724950298301761, 0.1157209965318159678767,
+      -0.07101273159581146501042, 0.02656886471476153677619},
+     {-0.0390625, 0.1088400233988091816746, -0.2040293534695560887946,
+      0.63425183007074690712, 0.63425183007074690712, -0.2040293534695560887946,
+      0.1088400233988091816746, -0.0390625},
+     {0.02656886471476153677619, -0.07101273159581146501042,
+      0.1157209965318159678767, -0.2063491724950298301761,
+      0.6458262927229572593084, 0.6211128101503285960334,
+      -0.1947323378660034080706, 0.06286527783698134326236},
+     {-0.01839564413074760379003, 0.04823413317502414426652,
+      -0.07426343845739941112028, 0.114501847692819048533,
+      -0.2045571191722765042772, 0.660813468654549139196,
+      0.5976143472590356184775, -0.1239475950210044312856},
+     {0.01134029854678402572063, -0.02948507959360312159186,
+      0.04433494178435378867429, -0.06484379890853231006886,
+      0.1015337067167920367718, -0.1911308324656548154047,
+      0.6939304865766944381799, 0.4343202773431659577188}}};
+
+  static constexpr scs_matrix_type Dt = {
+    {{-8.534141500901195224401, 8.969245745207215330466,
+      -0.5347697207870115236128, 0.1372431920303529866731,
+      -0.05597669179988967444165, 0.02877382456870841111616,
+      -0.01619304774930025308218, 0.005818199431119947281925},
+     {0.4795456477348782915988, -4.58965599527223671705,
+      4.410392043567378309582, -0.3843382802754971915943,
+      0.1204229979091044695349, -0.05570183862587374511383,
+      0.02989833895589766536542, -0.01056291399365108232241},
+     {-0.1058062186696254841629, 0.4179747347893139082711,
+      -3.341920904503003030144, 3.285879698983305163487,
+      -0.3354483643190853492096, 0.1160057520451498912003,
+      -0.05558355407039529680704, 0.01889885574434019736538},
+     {0.0390625, -0.1248537463656920922002, 0.3448188117424295242082,
+      -3.030359293393398982738, 3.030359293393398982738,
+      -0.3448188117424295242082, 0.1248537463656920922002, -0.0390625},
+     {-0.01889885574434019736538, 0.05558355407039529680704,
+      -0.1160057520451498912003, 0.3354483643190853492096,
+      -3.285879698983305163487, 3.341920904503003030144,
+      -0.4179747347893139082711, 0.1058062186696254841629},
+     {0.01056291399365108232241, -0.02989833895589766536542,
+      0.05570183862587374511383, -0.1204229979091044695349,
+      0.3843382802754971915943, -4.410392043567378309582,
+      4.58965599527223671705, -0.4795456477348782915988},
+     {-0.005818199431119947281925, 0.01619304774930025308218,
+      -0.02877382456870841111616, 0.05597669179988967444165,
+      -0.1372431920303529866731, 0.5347697207870115236128,
+      -8.969245745207215330466, 8.534141500901195224401}}};
+
+  static constexpr linear_nodal_matrix_type Nlin = {
+    {{1, 0.9358700742548033076687, 0.7958500907165711510723,
+      0.6046496089512394343843, 0.3953503910487605656157,
+      0.2041499092834288489277, 0.06412992574519669233128, 0},
+     {0, 0.06412992574519669233128, 0.2041499092834288489277,
+      0.3953503910487605656157, 0.6046496089512394343843,
+      0.7958500907165711510723, 0.9358700742548033076687, 1}}};
+
+  static constexpr linear_scs_matrix_type Ntlin = {
+    {{0.9745539561713792622631, 0.8707655927996972199319,
+      0.7029225756886985834533, 0.5, 0.2970774243113014165467,
+      0.1292344072003027800681, 0.02544604382862073773691},
+     {0.02544604382862073773691, 0.1292344072003027800681,
+      0.2970774243113014165467, 0.5, 0.7029225756886985834533,
+      0.8707655927996972199319, 0.9745539561713792622631}}};
+
+  static constexpr ArrayND<double[8]> Wl = {
+    {0.05089208765724147547381, 0.2075767267433640846623,
+     0.3356860342219972729573, 0.4058451513773971669066,
+     0.4058451513773971669066, 0.3356860342219972729573,
+     0.2075767267433640846623, 0.05089208765724147547381}};
+};
+
+template <>
+struct Coeffs<8>
+{
+  using nodal_matrix_type = ArrayND<double[9][9]>;
+  using scs_matrix_type = ArrayND<double[8][9]>;
+  using linear_nodal_matrix_type = ArrayND<double[2][9]>;
+  using linear_scs_matrix_type = ArrayND<double[2][8]>;
+
+  static constexpr nodal_matrix_type W = {
+    {{0.02753855121467538631971, 0.01547934030359847566286,
+      -0.004985567433371187529486, 0.002725964490287838563919,
+      -0.001771876741825364815237, 0.001246810082711803612542,
+      -8.989872432631698418967e-4, 6.151353927523778020983e-4,
+      -2.392265631023914580707e-4},
+     {5.888812519912749973511e-4, 0.1419881359465719816731,
+      0.02678964292253321574682, -0.008733603392872164470918,
+      0.004899659953959144846833, -0.00323629319411691369333,
+      0.002261224272687937235598, -0.001523149928836259240842,
+      5.888812519912749973511e-4},
+     {-7.640378896415306138811e-4, 0.01012589502847105811617,
+      0.2366489808626559178062, 0.03128565555991224050184,
+      -0.009206540782875772873563, 0.004922849453961031750306,
+      -0.003124698126288286935396, 0.002010001280744626636028,
+      -7.640378896415306138811e-4},
+     {8.596840782151280047124e-4, -0.003544118386612727075847,
+      0.02001039154194463608514, 0.2989509951784322585034,
+      0.03149632553708550667771, -0.008270801868921050447159,
+      0.004089180375878594314579, -0.002353573113558293188975,
+      8.596840782151280047124e-4},
+     {-8.906017549249618602231e-4, 0.002697695037674284661701,
+      -0.006251454672615921600848, 0.02753693466365130079455,
+      0.3206841384437302058886, 0.02753693466365130079455,
+      -0.006251454672615921600848, 0.002697695037674284661701,
+      -8.906017549249618602231e-4},
+     {8.596840782151280047124e-4, -0.002353573113558293188975,
+      0.004089180375878594314579, -0.008270801868921050447159,
+      0.03149632553708550667771, 0.2989509951784322585034,
+      0.02001039154194463608514, -0.003544118386612727075847,
+      8.596840782151280047124e-4},
+     {-7.640378896415306138811e-4, 0.002010001280744626636028,
+      -0.003124698126288286935396, 0.004922849453961031750306,
+      -0.009206540782875772873563, 0.03128565555991224050184,
+      0.2366489808626559178062, 0.01012589502847105811617,
+      -7.640378896415306138811e-4},
+     {5.888812519912749973511e-4, -0.001523149928836259240842,
+      0.002261224272687937235598, -0.00323629319411691369333,
+      0.004899659953959144846833, -0.008733603392872164470918,
+      0.02678964292253321574682, 0.1419881359465719816731,
+      5.888812519912749973511e-4},
+     {-2.392265631023914580707e-4, 6.151353927523778020983e-4,
+      -8.989872432631698418967e-4, 0.001246810082711803612542,
+      -0.001771876741825364815237, 0.002725964490287838563919,
+      -0.004985567433371187529486, 0.01547934030359847566286,
+      0.02753855121467538631971}}};
+
+  static constexpr nodal_matrix_type D = {
+    {{-18, 24.34974517159306582647, -9.738701657211547265029,
+      5.544963906949378499561, -3.657142857142857142857,
+      2.590745676559354992186, -1.874440873446983243676,
+      1.284830632699588333341, -0.5},
+     {-4.087013702033676588979, 0, 5.78680581663731167409,
+      -2.696065440314056028994, 1.665221645005385180795,
+      -1.145653738455132319013, 0.8167563817413858781172,
+      -0.5557049812837167854027, 0.2156540187024989893852},
+     {0.9853600900745069519073, -3.48835875343445484116, 0,
+      3.576680940125615321004, -1.717832157195062777948,
+      1.079803811282630484445, -0.7383492771903861166528,
+      0.4923509383155074187198, -0.1896555919783564403166},
+     {-0.4446134492810906349552, 1.287960750063906548008,
+      -2.834458912079420395327, 0, 2.851915968462895388307,
+      -1.376964893760512089344, 0.8557261850926754046937,
+      -0.5473001605340514002869, 0.2077345120355971789042},
+     {0.2734375, -0.7417823979162542405764, 1.269413086358149532422,
+      -2.659310217573917992928, 0, 2.659310217573917992928,
+      -1.269413086358149532422, 0.7417823979162542405764, -0.2734375},
+     {-0.2077345120355971789042, 0.5473001605340514002869,
+      -0.8557261850926754046937, 1.376964893760512089344,
+      -2.851915968462895388307, 0, 2.834458912079420395327,
+      -1.287960750063906548008, 0.4446134492810906349552},
+     {0.1896555919783564403166, -0.4923509383155074187198,
+      0.7383492771903861166528, -1.079803811282630484445,
+      1.717832157195062777948, -3.576680940125615321004, 0,
+      3.48835875343445484116, -0.9853600900745069519073},
+     {-0.2156540187024989893852, 0.5557049812837167854027,
+      -0.8167563817413858781172, 1.145653738455132319013,
+      -1.665221645005385180795, 2.696065440314056028994,
+      -5.78680581663731167409, 0, 4.087013702033676588979},
+     {0.5, -1.284830632699588333341, 1.874440873446983243676,
+      -2.590745676559354992186, 3.657142857142857142857,
+      -5.544963906949378499561, 9.738701657211547265029,
+      -24.34974517159306582647, 18}}};
+
+  static constexpr scs_matrix_type Nt = {
+    {{0.4337509518771576115969, 0.69454763050669417684,
+      -0.1912712021344270397406, 0.1018591949239170430003,
+      -0.06559662289565308967195, 0.04596279483584462362322,
+      -0.03306891643063776969499, 0.02260278446296199910061,
+      -0.008786615145857555053413},
+     {-0.1238120368927635408664, 0.5960642593011896250678,
+      0.6624131821149836839257, -0.2050650812627149573888,
+      0.1155679035853609635928, -0.07665717772194716717885,
+      0.05369956918745465138463, -0.0362227557430136590598,
+      0.01401213743145040052289},
+     {0.06288225176545602955089, -0.1946011148368713594655,
+      0.6184921438459408613139, 0.6487340730633449342734,
+      -0.2076237629864822564623, 0.118566504780663664639,
+      -0.07798725317277651670213, 0.05109465121326286490318,
+      -0.01955749367253822205043},
+     {-0.03926405018612098137026, 0.1092499132738985359039,
+      -0.2041411446146674369464, 0.6301407320459061771256,
+      0.6392144955921210112214, -0.2071631657066965952774,
+      0.1171189565094929775692, -0.07224778072100559641828,
+      0.02709204380707190819216},
+     {0.02709204380707190819216, -0.07224778072100559641828,
+      0.1171189565094929775692, -0.2071631657066965952774,
+      0.6392144955921210112214, 0.6301407320459061771256,
+      -0.2041411446146674369464, 0.1092499132738985359039,
+      -0.03926405018612098137026},
+     {-0.01955749367253822205043, 0.05109465121326286490318,
+      -0.07798725317277651670213, 0.118566504780663664639,
+      -0.2076237629864822564623, 0.6487340730633449342734,
+      0.6184921438459408613139, -0.1946011148368713594655,
+      0.06288225176545602955089},
+     {0.01401213743145040052289, -0.0362227557430136590598,
+      0.05369956918745465138463, -0.07665717772194716717885,
+      0.1155679035853609635928, -0.2050650812627149573888,
+      0.6624131821149836839257, 0.5960642593011896250678,
+      -0.1238120368927635408664},
+     {-0.008786615145857555053413, 0.02260278446296199910061,
+      -0.03306891643063776969499, 0.04596279483584462362322,
+      -0.06559662289565308967195, 0.1018591949239170430003,
+      -0.1912712021344270397406, 0.69454763050669417684,
+      0.4337509518771576115969}}};
+
+  static constexpr scs_matrix_type Dt = {
+    {{-10.92292582247269020906, 11.47408353295217719006,
+      -0.6756226967183331896738, 0.1705691625633692367901,
+      -0.06830919065926985316607, 0.03473064878060506180759,
+      -0.02019505243676459669116, 0.01215172203218557287173,
+      -0.00448230404127921294077},
+     {0.6089110901040427542649, -5.781894290408223252447,
+      5.544125250389853789215, -0.4729916914488666117174,
+      0.1450643485848074288391, -0.06609608479317356083898,
+      0.03643482629805903870408, -0.02135241286792522937926,
+      0.007798964141425643359897},
+     {-0.1325322384071943096293, 0.5200101820387243401423,
+      -4.078314292276678340738, 3.994300331838028352665,
+      -0.3950731849621575775399, 0.1334231943131060230463,
+      -0.064842472191004968692, 0.0358485898889581638214,
+      -0.01282011024178168307567},
+     {0.04808439376625379907573, -0.1525148005145920507455,
+      0.4134490486933400060599, -3.506961474557191943246,
+      3.484698892725675473933, -0.3790364419247376736364,
+      0.1360865783235324560291, -0.06669892149617920663325,
+      0.0228927249838991391629},
+     {-0.0228927249838991391629, 0.06669892149617920663325,
+      -0.1360865783235324560291, 0.3790364419247376736364,
+      -3.484698892725675473933, 3.506961474557191943246,
+      -0.4134490486933400060599, 0.1525148005145920507455,
+      -0.04808439376625379907573},
+     {0.01282011024178168307567, -0.0358485898889581638214,
+      0.064842472191004968692, -0.1334231943131060230463,
+      0.3950731849621575775399, -3.994300331838028352665,
+      4.078314292276678340738, -0.5200101820387243401423,
+      0.1325322384071943096293},
+     {-0.007798964141425643359897, 0.02135241286792522937926,
+      -0.03643482629805903870408, 0.06609608479317356083898,
+      -0.1450643485848074288391, 0.4729916914488666117174,
+      -5.544125250389853789215, 5.781894290408223252447,
+      -0.6089110901040427542649},
+     {0.00448230404127921294077, -0.01215172203218557287173,
+      0.02019505243676459669116, -0.03473064878060506180759,
+      0.06830919065926985316607, -0.1705691625633692367901,
+      0.6756226967183331896738, -11.47408353295217719006,
+      10.92292582247269020906}}};
+
+  static constexpr linear_nodal_matrix_type Nlin = {
+    {{1, 0.9498789977057300786562, 0.8385931397553688767229,
+      0.6815587319130890793554, 0.5, 0.3184412680869109206446,
+      0.1614068602446311232771, 0.05012100229426992134383, 0},
+     {0, 0.05012100229426992134383, 0.1614068602446311232771,
+      0.3184412680869109206446, 0.5, 0.6815587319130890793554,
+      0.8385931397553688767229, 0.9498789977057300786562, 1}}};
+
+  static constexpr linear_scs_matrix_type Ntlin = {
+    {{0.9801449282487681158418, 0.8983332387068133697958,
+      0.7627662049581644929089, 0.5917173212478249024697,
+      0.4082826787521750975303, 0.2372337950418355070911,
+      0.1016667612931866302042, 0.01985507175123188415822},
+     {0.01985507175123188415822, 0.1016667612931866302042,
+      0.2372337950418355070911, 0.4082826787521750975303,
+      0.5917173212478249024697, 0.7627662049581644929089,
+      0.8983332387068133697958, 0.9801449282487681158418}}};
+
+  static constexpr ArrayND<double[9]> Wl = {
+    {0.03971014350246376831644, 0.163623379083909492092,
+     0.2711340674972977537738, 0.3420977674206791808783,
+     0.366869284991299609879, 0.3420977674206791808783,
+     0.2711340674972977537738, 0.163623379083909492092,
+     0.03971014350246376831644}};
+};
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
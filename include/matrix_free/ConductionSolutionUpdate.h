@@ -10,6 +10,7 @@
 #ifndef CONDUCTION_SOLUTION_UPDATE_H
 #define CONDUCTION_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevSmoother.h"
 #include "matrix_free/ConductionJacobiPreconditioner.h"
 #include "matrix_free/ConductionOperator.h"
 #include "matrix_free/KokkosViewTypes.h"
@@ -90,6 +91,8 @@ private:
   ConductionResidualOperator<p> resid_op_;
   ConductionLinearizedResidualOperator<p> lin_op_;
   JacobiOperator<p> prec_op_;
+  const bool use_chebyshev_;
+  ChebyshevSmoother chebyshev_op_;
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
 };
@@ -0,0 +1,37 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CONTINUITY_DIAGONAL_H
+#define CONTINUITY_DIAGONAL_H
+
+#include "matrix_free/PolynomialOrders.h"
+#include "matrix_free/KokkosViewTypes.h"
+#include "matrix_free/LinSysInfo.h"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+namespace impl {
+
+template <int p>
+struct continuity_diagonal_t
+{
+  static void invoke(
+    const_elem_offset_view<p> offsets,
+    const_scs_vector_view<p> metric,
+    tpetra_view_type owned_yout);
+};
+} // namespace impl
+P_INVOKEABLE(continuity_diagonal)
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
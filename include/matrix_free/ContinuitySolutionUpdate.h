@@ -13,6 +13,7 @@
 #include "matrix_free/ContinuityOperator.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
+#include "matrix_free/TwoLevelPreconditioner.h"
 
 #include "Teuchos_RCP.hpp"
 #include "Tpetra_Export.hpp"
@@ -49,7 +50,9 @@ public:
   compute_delta(const_scs_vector_view<p> laplacian_metric);
 
   void compute_preconditioner(
-    Tpetra::CrsMatrix<>& mat, Teuchos::ParameterList& params);
+    Tpetra::CrsMatrix<>& mat,
+    Teuchos::ParameterList& params,
+    const_scs_vector_view<p> laplacian_metric);
 
   const MatrixFreeSolver& solver() const { return linear_solver_; }
   double residual_norm() const;
@@ -65,6 +68,10 @@ private:
   ContinuityLinearizedResidualOperator<p> lin_op_;
   Teuchos::RCP<Tpetra::Operator<>> prec_op_;
 
+  const bool use_two_level_;
+  TwoLevelPreconditioner two_level_op_;
+  Tpetra::MultiVector<> owned_and_shared_diagonal_;
+
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
 };
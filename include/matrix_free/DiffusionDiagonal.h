@@ -0,0 +1,66 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef DIFFUSION_DIAGONAL_H
+#define DIFFUSION_DIAGONAL_H
+
+#include "matrix_free/Coefficients.h"
+#include "matrix_free/KokkosFramework.h"
+#include "matrix_free/ShuffledAccess.h"
+
+#include "Kokkos_Macros.hpp"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+namespace impl {
+
+// diagonal of the diffusion operator for the flux surfaces normal to dir,
+// shared by the conduction and continuity diagonals
+template <int p, int dir, typename MetricType, typename LHSType>
+KOKKOS_FUNCTION void
+diffusion_diagonal(
+  int index,
+  const typename Coeffs<p>::nodal_matrix_type& vandermonde,
+  const typename Coeffs<p>::nodal_matrix_type& nodal_derivative,
+  const typename Coeffs<p>::scs_matrix_type& flux_point_derivative,
+  const typename Coeffs<p>::scs_matrix_type& flux_point_interpolant,
+  const MetricType& metric,
+  LHSType& lhs)
+{
+  for (int l = 0; l < p; ++l) {
+    for (int s = 0; s < p + 1; ++s) {
+      for (int r = 0; r < p + 1; ++r) {
+        const ftype Ws = vandermonde(s, s);
+        const ftype Wr = vandermonde(r, r);
+        const ftype orth = Ws * Wr * metric(index, dir, l, s, r, 0);
+        ftype non_orth = 0;
+        for (int q = 0; q < p + 1; ++q) {
+          non_orth += Ws * vandermonde(r, q) * nodal_derivative(q, r) *
+                        metric(index, dir, l, s, q, 1) +
+                      Wr * vandermonde(s, q) * nodal_derivative(q, s) *
+                        metric(index, dir, l, q, r, 2);
+        }
+        shuffled_access<dir>(lhs, s, r, l + 0) +=
+          orth * flux_point_derivative(l, l + 0) +
+          flux_point_interpolant(l, l + 0) * non_orth;
+        shuffled_access<dir>(lhs, s, r, l + 1) -=
+          orth * flux_point_derivative(l, l + 1) +
+          flux_point_interpolant(l, l + 1) * non_orth;
+      }
+    }
+  }
+}
+
+} // namespace impl
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -106,25 +106,25 @@ public:
   virtual const LowMachPostProcess& post_processor() const = 0;
 };
 
+#define MAKE_UPDATER_CASE(order, unused)                                       \
+  case order:                                                                  \
+    return std::unique_ptr<PhysicsUpdate<order>>(                              \
+      new PhysicsUpdate<order>(std::forward<Args>(args)...));
+
 template <template <int> class PhysicsUpdate, typename... Args>
 std::unique_ptr<typename PhysicsUpdate<inst::P1>::update_type>
 make_updater(int p, Args&&... args)
 {
   switch (p) {
-  case inst::P2:
-    return std::unique_ptr<PhysicsUpdate<inst::P2>>(
-      new PhysicsUpdate<inst::P2>(std::forward<Args>(args)...));
-  case inst::P3:
-    return std::unique_ptr<PhysicsUpdate<inst::P3>>(
-      new PhysicsUpdate<inst::P3>(std::forward<Args>(args)...));
-  case inst::P4:
-    return std::unique_ptr<PhysicsUpdate<inst::P4>>(
-      new PhysicsUpdate<inst::P4>(std::forward<Args>(args)...));
-  default:
+  case inst::P1:
     return std::unique_ptr<PhysicsUpdate<inst::P1>>(
       new PhysicsUpdate<inst::P1>(std::forward<Args>(args)...));
+    NALU_MATRIX_FREE_FOR_EACH_HIGHER_ORDER(MAKE_UPDATER_CASE, unused)
+  default:
+    throw_unsupported_polynomial_order(p);
   }
 }
+#undef MAKE_UPDATER_CASE
 
 inline bool
 part_is_valid_for_matrix_free(int order, const stk::mesh::Part& part)
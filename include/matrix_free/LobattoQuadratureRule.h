@@ -49,6 +49,40 @@ struct GLL<4>
      +0.654653670707977143798292456247, +1}};
 };
 
+template <>
+struct GLL<5>
+{
+  static constexpr Kokkos::Array<double, 6> nodes = {
+    {-1, -0.765055323929464692851, -0.2852315164806450963142,
+     0.2852315164806450963142, 0.765055323929464692851, 1}};
+};
+
+template <>
+struct GLL<6>
+{
+  static constexpr Kokkos::Array<double, 7> nodes = {
+    {-1, -0.830223896278566929872, -0.4688487934707142138038, 0,
+     0.4688487934707142138038, 0.830223896278566929872, 1}};
+};
+
+template <>
+struct GLL<7>
+{
+  static constexpr Kokkos::Array<double, 8> nodes = {
+    {-1, -0.8717401485096066153374, -0.5917001814331423021445,
+     -0.2092992179024788687687, 0.2092992179024788687687,
+     0.5917001814331423021445, 0.8717401485096066153374, 1}};
+};
+
+template <>
+struct GLL<8>
+{
+  static constexpr Kokkos::Array<double, 9> nodes = {
+    {-1, -0.8997579954114601573123, -0.6771862795107377534459,
+     -0.3631174638261781587108, 0, 0.3631174638261781587108,
+     0.6771862795107377534459, 0.8997579954114601573123, 1}};
+};
+
 double gauss_lobatto_legendre_abscissae(int p, int n);
 std::vector<double> gauss_lobatto_legendre_abscissae(int p);
 
@@ -81,6 +81,264 @@ struct StkNodeOrderMapping<4>
       {7, 40, 39, 38, 6}}}};
 };
 
+template <>
+struct StkNodeOrderMapping<5>
+{
+  using node_map_type = ArrayND<int[6][6][6]>;
+  static constexpr node_map_type map = {
+    {{{0, 8, 9, 10, 11, 1},
+      {23, 56, 60, 64, 68, 12},
+      {22, 57, 61, 65, 69, 13},
+      {21, 58, 62, 66, 70, 14},
+      {20, 59, 63, 67, 71, 15},
+      {3, 19, 18, 17, 16, 2}},
+     {{24, 120, 121, 122, 123, 28},
+      {88, 152, 153, 154, 155, 104},
+      {92, 156, 157, 158, 159, 105},
+      {96, 160, 161, 162, 163, 106},
+      {100, 164, 165, 166, 167, 107},
+      {36, 139, 138, 137, 136, 32}},
+     {{25, 124, 125, 126, 127, 29},
+      {89, 168, 169, 170, 171, 108},
+      {93, 172, 173, 174, 175, 109},
+      {97, 176, 177, 178, 179, 110},
+      {101, 180, 181, 182, 183, 111},
+      {37, 143, 142, 141, 140, 33}},
+     {{26, 128, 129, 130, 131, 30},
+      {90, 184, 185, 186, 187, 112},
+      {94, 188, 189, 190, 191, 113},
+      {98, 192, 193, 194, 195, 114},
+      {102, 196, 197, 198, 199, 115},
+      {38, 147, 146, 145, 144, 34}},
+     {{27, 132, 133, 134, 135, 31},
+      {91, 200, 201, 202, 203, 116},
+      {95, 204, 205, 206, 207, 117},
+      {99, 208, 209, 210, 211, 118},
+      {103, 212, 213, 214, 215, 119},
+      {39, 151, 150, 149, 148, 35}},
+     {{4, 40, 41, 42, 43, 5},
+      {55, 72, 73, 74, 75, 44},
+      {54, 76, 77, 78, 79, 45},
+      {53, 80, 81, 82, 83, 46},
+      {52, 84, 85, 86, 87, 47},
+      {7, 51, 50, 49, 48, 6}}}};
+};
+
+template <>
+struct StkNodeOrderMapping<6>
+{
+  using node_map_type = ArrayND<int[7][7][7]>;
+  static constexpr node_map_type map = {
+    {{{0, 8, 9, 10, 11, 12, 1},
+      {27, 68, 73, 78, 83, 88, 13},
+      {26, 69, 74, 79, 84, 89, 14},
+      {25, 70, 75, 80, 85, 90, 15},
+      {24, 71, 76, 81, 86, 91, 16},
+      {23, 72, 77, 82, 87, 92, 17},
+      {3, 22, 21, 20, 19, 18, 2}},
+     {{28, 168, 169, 170, 171, 172, 33},
+      {118, 218, 219, 220, 221, 222, 143},
+      {123, 223, 224, 225, 226, 227, 144},
+      {128, 228, 229, 230, 231, 232, 145},
+      {133, 233, 234, 235, 236, 237, 146},
+      {138, 238, 239, 240, 241, 242, 147},
+      {43, 197, 196, 195, 194, 193, 38}},
+     {{29, 173, 174, 175, 176, 177, 34},
+      {119, 243, 244, 245, 246, 247, 148},
+      {124, 248, 249, 250, 251, 252, 149},
+      {129, 253, 254, 255, 256, 257, 150},
+      {134, 258, 259, 260, 261, 262, 151},
+      {139, 263, 264, 265, 266, 267, 152},
+      {44, 202, 201, 200, 199, 198, 39}},
+     {{30, 178, 179, 180, 181, 182, 35},
+      {120, 268, 269, 270, 271, 272, 153},
+      {125, 273, 274, 275, 276, 277, 154},
+      {130, 278, 279, 280, 281, 282, 155},
+      {135, 283, 284, 285, 286, 287, 156},
+      {140, 288, 289, 290, 291, 292, 157},
+      {45, 207, 206, 205, 204, 203, 40}},
+     {{31, 183, 184, 185, 186, 187, 36},
+      {121, 293, 294, 295, 296, 297, 158},
+      {126, 298, 299, 300, 301, 302, 159},
+      {131, 303, 304, 305, 306, 307, 160},
+      {136, 308, 309, 310, 311, 312, 161},
+      {141, 313, 314, 315, 316, 317, 162},
+      {46, 212, 211, 210, 209, 208, 41}},
+     {{32, 188, 189, 190, 191, 192, 37},
+      {122, 318, 319, 320, 321, 322, 163},
+      {127, 323, 324, 325, 326, 327, 164},
+      {132, 328, 329, 330, 331, 332, 165},
+      {137, 333, 334, 335, 336, 337, 166},
+      {142, 338, 339, 340, 341, 342, 167},
+      {47, 217, 216, 215, 214, 213, 42}},
+     {{4, 48, 49, 50, 51, 52, 5},
+      {67, 93, 94, 95, 96, 97, 53},
+      {66, 98, 99, 100, 101, 102, 54},
+      {65, 103, 104, 105, 106, 107, 55},
+      {64, 108, 109, 110, 111, 112, 56},
+      {63, 113, 114, 115, 116, 117, 57},
+      {7, 62, 61, 60, 59, 58, 6}}}};
+};
+
+template <>
+struct StkNodeOrderMapping<7>
+{
+  using node_map_type = ArrayND<int[8][8][8]>;
+  static constexpr node_map_type map = {
+    {{{0, 8, 9, 10, 11, 12, 13, 1},
+      {31, 80, 86, 92, 98, 104, 110, 14},
+      {30, 81, 87, 93, 99, 105, 111, 15},
+      {29, 82, 88, 94, 100, 106, 112, 16},
+      {28, 83, 89, 95, 101, 107, 113, 17},
+      {27, 84, 90, 96, 102, 108, 114, 18},
+      {26, 85, 91, 97, 103, 109, 115, 19},
+      {3, 25, 24, 23, 22, 21, 20, 2}},
+     {{32, 224, 225, 226, 227, 228, 229, 38},
+      {152, 296, 297, 298, 299, 300, 301, 188},
+      {158, 302, 303, 304, 305, 306, 307, 189},
+      {164, 308, 309, 310, 311, 312, 313, 190},
+      {170, 314, 315, 316, 317, 318, 319, 191},
+      {176, 320, 321, 322, 323, 324, 325, 192},
+      {182, 326, 327, 328, 329, 330, 331, 193},
+      {50, 265, 264, 263, 262, 261, 260, 44}},
+     {{33, 230, 231, 232, 233, 234, 235, 39},
+      {153, 332, 333, 334, 335, 336, 337, 194},
+      {159, 338, 339, 340, 341, 342, 343, 195},
+      {165, 344, 345, 346, 347, 348, 349, 196},
+      {171, 350, 351, 352, 353, 354, 355, 197},
+      {177, 356, 357, 358, 359, 360, 361, 198},
+      {183, 362, 363, 364, 365, 366, 367, 199},
+      {51, 271, 270, 269, 268, 267, 266, 45}},
+     {{34, 236, 237, 238, 239, 240, 241, 40},
+      {154, 368, 369, 370, 371, 372, 373, 200},
+      {160, 374, 375, 376, 377, 378, 379, 201},
+      {166, 380, 381, 382, 383, 384, 385, 202},
+      {172, 386, 387, 388, 389, 390, 391, 203},
+      {178, 392, 393, 394, 395, 396, 397, 204},
+      {184, 398, 399, 400, 401, 402, 403, 205},
+      {52, 277, 276, 275, 274, 273, 272, 46}},
+     {{35, 242, 243, 244, 245, 246, 247, 41},
+      {155, 404, 405, 406, 407, 408, 409, 206},
+      {161, 410, 411, 412, 413, 414, 415, 207},
+      {167, 416, 417, 418, 419, 420, 421, 208},
+      {173, 422, 423, 424, 425, 426, 427, 209},
+      {179, 428, 429, 430, 431, 432, 433, 210},
+      {185, 434, 435, 436, 437, 438, 439, 211},
+      {53, 283, 282, 281, 280, 279, 278, 47}},
+     {{36, 248, 249, 250, 251, 252, 253, 42},
+      {156, 440, 441, 442, 443, 444, 445, 212},
+      {162, 446, 447, 448, 449, 450, 451, 213},
+      {168, 452, 453, 454, 455, 456, 457, 214},
+      {174, 458, 459, 460, 461, 462, 463, 215},
+      {180, 464, 465, 466, 467, 468, 469, 216},
+      {186, 470, 471, 472, 473, 474, 475, 217},
+      {54, 289, 288, 287, 286, 285, 284, 48}},
+     {{37, 254, 255, 256, 257, 258, 259, 43},
+      {157, 476, 477, 478, 479, 480, 481, 218},
+      {163, 482, 483, 484, 485, 486, 487, 219},
+      {169, 488, 489, 490, 491, 492, 493, 220},
+      {175, 494, 495, 496, 497, 498, 499, 221},
+      {181, 500, 501, 502, 503, 504, 505, 222},
+      {187, 506, 507, 508, 509, 510, 511, 223},
+      {55, 295, 294, 293, 292, 291, 290, 49}},
+     {{4, 56, 57, 58, 59, 60, 61, 5},
+      {79, 116, 117, 118, 119, 120, 121, 62},
+      {78, 122, 123, 124, 125, 126, 127, 63},
+      {77, 128, 129, 130, 131, 132, 133, 64},
+      {76, 134, 135, 136, 137, 138, 139, 65},
+      {75, 140, 141, 142, 143, 144, 145, 66},
+      {74, 146, 147, 148, 149, 150, 151, 67},
+      {7, 73, 72, 71, 70, 69, 68, 6}}}};
+};
+
+template <>
+struct StkNodeOrderMapping<8>
+{
+  using node_map_type = ArrayND<int[9][9][9]>;
+  static constexpr node_map_type map = {
+    {{{0, 8, 9, 10, 11, 12, 13, 14, 1},
+      {35, 92, 99, 106, 113, 120, 127, 134, 15},
+      {34, 93, 100, 107, 114, 121, 128, 135, 16},
+      {33, 94, 101, 108, 115, 122, 129, 136, 17},
+      {32, 95, 102, 109, 116, 123, 130, 137, 18},
+      {31, 96, 103, 110, 117, 124, 131, 138, 19},
+      {30, 97, 104, 111, 118, 125, 132, 139, 20},
+      {29, 98, 105, 112, 119, 126, 133, 140, 21},
+      {3, 28, 27, 26, 25, 24, 23, 22, 2}},
+     {{36, 288, 289, 290, 291, 292, 293, 294, 43},
+      {190, 386, 387, 388, 389, 390, 391, 392, 239},
+      {197, 393, 394, 395, 396, 397, 398, 399, 240},
+      {204, 400, 401, 402, 403, 404, 405, 406, 241},
+      {211, 407, 408, 409, 410, 411, 412, 413, 242},
+      {218, 414, 415, 416, 417, 418, 419, 420, 243},
+      {225, 421, 422, 423, 424, 425, 426, 427, 244},
+      {232, 428, 429, 430, 431, 432, 433, 434, 245},
+      {57, 343, 342, 341, 340, 339, 338, 337, 50}},
+     {{37, 295, 296, 297, 298, 299, 300, 301, 44},
+      {191, 435, 436, 437, 438, 439, 440, 441, 246},
+      {198, 442, 443, 444, 445, 446, 447, 448, 247},
+      {205, 449, 450, 451, 452, 453, 454, 455, 248},
+      {212, 456, 457, 458, 459, 460, 461, 462, 249},
+      {219, 463, 464, 465, 466, 467, 468, 469, 250},
+      {226, 470, 471, 472, 473, 474, 475, 476, 251},
+      {233, 477, 478, 479, 480, 481, 482, 483, 252},
+      {58, 350, 349, 348, 347, 346, 345, 344, 51}},
+     {{38, 302, 303, 304, 305, 306, 307, 308, 45},
+      {192, 484, 485, 486, 487, 488, 489, 490, 253},
+      {199, 491, 492, 493, 494, 495, 496, 497, 254},
+      {206, 498, 499, 500, 501, 502, 503, 504, 255},
+      {213, 505, 506, 507, 508, 509, 510, 511, 256},
+      {220, 512, 513, 514, 515, 516, 517, 518, 257},
+      {227, 519, 520, 521, 522, 523, 524, 525, 258},
+      {234, 526, 527, 528, 529, 530, 531, 532, 259},
+      {59, 357, 356, 355, 354, 353, 352, 351, 52}},
+     {{39, 309, 310, 311, 312, 313, 314, 315, 46},
+      {193, 533, 534, 535, 536, 537, 538, 539, 260},
+      {200, 540, 541, 542, 543, 544, 545, 546, 261},
+      {207, 547, 548, 549, 550, 551, 552, 553, 262},
+      {214, 554, 555, 556, 557, 558, 559, 560, 263},
+      {221, 561, 562, 563, 564, 565, 566, 567, 264},
+      {228, 568, 569, 570, 571, 572, 573, 574, 265},
+      {235, 575, 576, 577, 578, 579, 580, 581, 266},
+      {60, 364, 363, 362, 361, 360, 359, 358, 53}},
+     {{40, 316, 317, 318, 319, 320, 321, 322, 47},
+      {194, 582, 583, 584, 585, 586, 587, 588, 267},
+      {201, 589, 590, 591, 592, 593, 594, 595, 268},
+      {208, 596, 597, 598, 599, 600, 601, 602, 269},
+      {215, 603, 604, 605, 606, 607, 608, 609, 270},
+      {222, 610, 611, 612, 613, 614, 615, 616, 271},
+      {229, 617, 618, 619, 620, 621, 622, 623, 272},
+      {236, 624, 625, 626, 627, 628, 629, 630, 273},
+      {61, 371, 370, 369, 368, 367, 366, 365, 54}},
+     {{41, 323, 324, 325, 326, 327, 328, 329, 48},
+      {195, 631, 632, 633, 634, 635, 636, 637, 274},
+      {202, 638, 639, 640, 641, 642, 643, 644, 275},
+      {209, 645, 646, 647, 648, 649, 650, 651, 276},
+      {216, 652, 653, 654, 655, 656, 657, 658, 277},
+      {223, 659, 660, 661, 662, 663, 664, 665, 278},
+      {230, 666, 667, 668, 669, 670, 671, 672, 279},
+      {237, 673, 674, 675, 676, 677, 678, 679, 280},
+      {62, 378, 377, 376, 375, 374, 373, 372, 55}},
+     {{42, 330, 331, 332, 333, 334, 335, 336, 49},
+      {196, 680, 681, 682, 683, 684, 685, 686, 281},
+      {203, 687, 688, 689, 690, 691, 692, 693, 282},
+      {210, 694, 695, 696, 697, 698, 699, 700, 283},
+      {217, 701, 702, 703, 704, 705, 706, 707, 284},
+      {224, 708, 709, 710, 711, 712, 713, 714, 285},
+      {231, 715, 716, 717, 718, 719, 720, 721, 286},
+      {238, 722, 723, 724, 725, 726, 727, 728, 287},
+      {63, 385, 384, 383, 382, 381, 380, 379, 56}},
+     {{4, 64, 65, 66, 67, 68, 69, 70, 5},
+      {91, 141, 142, 143, 144, 145, 146, 147, 71},
+      {90, 148, 149, 150, 151, 152, 153, 154, 72},
+      {89, 155, 156, 157, 158, 159, 160, 161, 73},
+      {88, 162, 163, 164, 165, 166, 167, 168, 74},
+      {87, 169, 170, 171, 172, 173, 174, 175, 75},
+      {86, 176, 177, 178, 179, 180, 181, 182, 76},
+      {85, 183, 184, 185, 186, 187, 188, 189, 77},
+      {7, 84, 83, 82, 81, 80, 79, 78, 6}}}};
+};
+
 template <int>
 struct StkFaceNodeMapping
 {
@@ -120,6 +378,64 @@ struct StkFaceNodeMapping<4>
      {3, 12, 11, 10, 2}}};
 };
 
+template <>
+struct StkFaceNodeMapping<5>
+{
+  using node_map_type = ArrayND<int[6][6]>;
+  static constexpr node_map_type map = {
+    {{0, 4, 5, 6, 7, 1},
+     {19, 20, 21, 22, 23, 8},
+     {18, 24, 25, 26, 27, 9},
+     {17, 28, 29, 30, 31, 10},
+     {16, 32, 33, 34, 35, 11},
+     {3, 15, 14, 13, 12, 2}}};
+};
+
+template <>
+struct StkFaceNodeMapping<6>
+{
+  using node_map_type = ArrayND<int[7][7]>;
+  static constexpr node_map_type map = {
+    {{0, 4, 5, 6, 7, 8, 1},
+     {23, 24, 25, 26, 27, 28, 9},
+     {22, 29, 30, 31, 32, 33, 10},
+     {21, 34, 35, 36, 37, 38, 11},
+     {20, 39, 40, 41, 42, 43, 12},
+     {19, 44, 45, 46, 47, 48, 13},
+     {3, 18, 17, 16, 15, 14, 2}}};
+};
+
+template <>
+struct StkFaceNodeMapping<7>
+{
+  using node_map_type = ArrayND<int[8][8]>;
+  static constexpr node_map_type map = {
+    {{0, 4, 5, 6, 7, 8, 9, 1},
+     {27, 28, 29, 30, 31, 32, 33, 10},
+     {26, 34, 35, 36, 37, 38, 39, 11},
+     {25, 40, 41, 42, 43, 44, 45, 12},
+     {24, 46, 47, 48, 49, 50, 51, 13},
+     {23, 52, 53, 54, 55, 56, 57, 14},
+     {22, 58, 59, 60, 61, 62, 63, 15},
+     {3, 21, 20, 19, 18, 17, 16, 2}}};
+};
+
+template <>
+struct StkFaceNodeMapping<8>
+{
+  using node_map_type = ArrayND<int[9][9]>;
+  static constexpr node_map_type map = {
+    {{0, 4, 5, 6, 7, 8, 9, 10, 1},
+     {31, 32, 33, 34, 35, 36, 37, 38, 11},
+     {30, 39, 40, 41, 42, 43, 44, 45, 12},
+     {29, 46, 47, 48, 49, 50, 51, 52, 13},
+     {28, 53, 54, 55, 56, 57, 58, 59, 14},
+     {27, 60, 61, 62, 63, 64, 65, 66, 15},
+     {26, 67, 68, 69, 70, 71, 72, 73, 16},
+     {25, 74, 75, 76, 77, 78, 79, 80, 17},
+     {3, 24, 23, 22, 21, 20, 19, 18, 2}}};
+};
+
 int node_map(int poly, int n, int m, int l);
 
 } // namespace matrix_free
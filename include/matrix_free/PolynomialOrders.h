@@ -12,6 +12,8 @@
 
 // tools for dealing with polynomial order templates
 
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #ifndef NALU_POLYNOMIAL_ORDER1
@@ -30,6 +32,44 @@
 #define NALU_POLYNOMIAL_ORDER4 4
 #endif
 
+// P1-P4 are always instantiated.  Higher orders are opt-in at configure time
+// (NALU_MATRIX_FREE_EXTRA_ORDERS) since each one adds a full set of kernel
+// instantiations to the build.
+#ifdef NALU_MATRIX_FREE_P5
+#define NALU_MATRIX_FREE_ORDER_P5(X, ...) X(inst::P5, __VA_ARGS__)
+#else
+#define NALU_MATRIX_FREE_ORDER_P5(X, ...)
+#endif
+
+#ifdef NALU_MATRIX_FREE_P6
+#define NALU_MATRIX_FREE_ORDER_P6(X, ...) X(inst::P6, __VA_ARGS__)
+#else
+#define NALU_MATRIX_FREE_ORDER_P6(X, ...)
+#endif
+
+#ifdef NALU_MATRIX_FREE_P7
+#define NALU_MATRIX_FREE_ORDER_P7(X, ...) X(inst::P7, __VA_ARGS__)
+#else
+#define NALU_MATRIX_FREE_ORDER_P7(X, ...)
+#endif
+
+#ifdef NALU_MATRIX_FREE_P8
+#define NALU_MATRIX_FREE_ORDER_P8(X, ...) X(inst::P8, __VA_ARGS__)
+#else
+#define NALU_MATRIX_FREE_ORDER_P8(X, ...)
+#endif
+
+// applies X(order, args...) to every instantiated order except P1, which
+// is always built and serves as the reference instantiation for return types
+#define NALU_MATRIX_FREE_FOR_EACH_HIGHER_ORDER(X, ...)                         \
+  X(inst::P2, __VA_ARGS__)                                                     \
+  X(inst::P3, __VA_ARGS__)                                                     \
+  X(inst::P4, __VA_ARGS__)                                                     \
+  NALU_MATRIX_FREE_ORDER_P5(X, __VA_ARGS__)                                    \
+  NALU_MATRIX_FREE_ORDER_P6(X, __VA_ARGS__)                                    \
+  NALU_MATRIX_FREE_ORDER_P7(X, __VA_ARGS__)                                    \
+  NALU_MATRIX_FREE_ORDER_P8(X, __VA_ARGS__)
+
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
@@ -38,15 +78,37 @@ enum {
   P1 = NALU_POLYNOMIAL_ORDER1,
   P2 = NALU_POLYNOMIAL_ORDER2,
   P3 = NALU_POLYNOMIAL_ORDER3,
-  P4 = NALU_POLYNOMIAL_ORDER4
+  P4 = NALU_POLYNOMIAL_ORDER4,
+  P5 = 5,
+  P6 = 6,
+  P7 = 7,
+  P8 = 8
 };
 }
 
+#define NALU_MATRIX_FREE_ORDER_IS(order, p) || (p) == (order)
+
+constexpr bool
+polynomial_order_is_instantiated(int p)
+{
+  return p == inst::P1 NALU_MATRIX_FREE_FOR_EACH_HIGHER_ORDER(
+                          NALU_MATRIX_FREE_ORDER_IS, p);
+}
+
+[[noreturn]] inline void
+throw_unsupported_polynomial_order(int p)
+{
+  throw std::runtime_error(
+    "Polynomial order " + std::to_string(p) +
+    " is not instantiated for the matrix-free operators; reconfigure with "
+    "NALU_MATRIX_FREE_EXTRA_ORDERS to build it");
+}
+
+#define INSTANTIATE_ORDER(order, type, Name) template type Name<order>;
+
 #define INSTANTIATE_TYPE(type, Name)                                           \
-  template type Name<inst::P1>;                                                \
-  template type Name<inst::P2>;                                                \
-  template type Name<inst::P3>;                                                \
-  template type Name<inst::P4>
+  NALU_MATRIX_FREE_FOR_EACH_HIGHER_ORDER(INSTANTIATE_ORDER, type, Name)        \
+  template type Name<inst::P1>
 
 #define INSTANTIATE_POLYCLASS(ClassName) INSTANTIATE_TYPE(class, ClassName)
 #define INSTANTIATE_POLYSTRUCT(ClassName) INSTANTIATE_TYPE(struct, ClassName)
@@ -61,6 +123,10 @@ enum {
     return IMPLNAME(func)<p>::invoke(std::forward<Args>(args)...);             \
   }
 
+#define SWITCH_INVOKEABLE_CASE(order, func)                                    \
+  case order:                                                                  \
+    return IMPLNAME(func)<order>::invoke(std::forward<Args>(args)...);
+
 // can't return a value dependent on template parameter
 #define SWITCH_INVOKEABLE(func)                                                    \
   template <typename... Args>                                                      \
@@ -68,14 +134,11 @@ enum {
     -> decltype(IMPLNAME(func) < inst::P1 > ::invoke(std::forward<Args>(args)...)) \
   {                                                                                \
     switch (p) {                                                                   \
-    case inst::P2:                                                                 \
-      return IMPLNAME(func)<inst::P2>::invoke(std::forward<Args>(args)...);        \
-    case inst::P3:                                                                 \
-      return IMPLNAME(func)<inst::P3>::invoke(std::forward<Args>(args)...);        \
-    case inst::P4:                                                                 \
-      return IMPLNAME(func)<inst::P4>::invoke(std::forward<Args>(args)...);        \
-    default:                                                                       \
+    case inst::P1:                                                                 \
       return IMPLNAME(func)<inst::P1>::invoke(std::forward<Args>(args)...);        \
+      NALU_MATRIX_FREE_FOR_EACH_HIGHER_ORDER(SWITCH_INVOKEABLE_CASE, func)         \
+    default:                                                                       \
+      throw_unsupported_polynomial_order(p);                                       \
     }                                                                              \
   }
 
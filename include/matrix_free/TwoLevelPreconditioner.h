@@ -0,0 +1,82 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TWO_LEVEL_PRECONDITIONER_H
+#define TWO_LEVEL_PRECONDITIONER_H
+
+#include "matrix_free/ChebyshevSmoother.h"
+
+#include "Teuchos_BLAS_types.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_Map.hpp"
+#include "Tpetra_MultiVector.hpp"
+#include "Tpetra_Operator.hpp"
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+// two-level V-cycle: the high-order, matrix-free operator is smoothed with a
+// Chebyshev-accelerated Jacobi iteration and the coarse-grid correction is
+// computed with a user-provided operator, typically AMG on the low-order
+// refined "sparsified" edge Laplacian that shares the high-order nodes
+class TwoLevelPreconditioner final : public Tpetra::Operator<>
+{
+public:
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using base_operator_type = Tpetra::Operator<>;
+
+  TwoLevelPreconditioner(
+    Teuchos::RCP<const map_type> owned_map,
+    int num_vectors,
+    ChebyshevOptions options = {});
+
+  void apply(
+    const mv_type& x,
+    mv_type& y,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  void set_fine_operator(Teuchos::RCP<const base_operator_type> op)
+  {
+    fine_op_ = op;
+    smoother_.set_linear_operator(op);
+  }
+  void set_coarse_operator(Teuchos::RCP<const base_operator_type> op)
+  {
+    coarse_op_ = op;
+  }
+
+  // inverse of the fine operator's diagonal, stored in the first column
+  mv_type& get_inverse_diagonal() { return smoother_.get_inverse_diagonal(); }
+
+  void compute_eigenvalue_estimate() { smoother_.compute_eigenvalue_estimate(); }
+  double max_eigenvalue() const { return smoother_.max_eigenvalue(); }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  const Teuchos::RCP<const map_type> map_;
+
+  Teuchos::RCP<const base_operator_type> fine_op_;
+  Teuchos::RCP<const base_operator_type> coarse_op_;
+  ChebyshevSmoother smoother_;
+
+  mutable mv_type residual_;
+  mutable mv_type correction_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -72,7 +72,7 @@ public:
     hasWallFunc_ = true;
   }
 
-  double total_volume() { return volStats_[2]; }
+  double total_volume();
 
 private:
   //! Flag to track whether wall functions are active
@@ -49,13 +49,14 @@ public:
 
   void add_open_mdot_post(const double&);
 
-  double mdot_inflow() const { return mdotInflow_; }
+  //! Global mass balance terms; completes the pending reductions
+  double mdot_inflow() const;
 
-  double mdot_rho_accum() const { return rhoAccum_; }
+  double mdot_rho_accum() const;
 
-  double mdot_open() const { return mdotOpen_; }
+  double mdot_open() const;
 
-  double mdot_open_post() const { return mdotOpenPost_; }
+  double mdot_open_post() const;
 
   const double& mdot_open_correction() const { return mdotOpenCorrection_; }
 
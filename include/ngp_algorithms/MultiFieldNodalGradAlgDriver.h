@@ -0,0 +1,54 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MULTIFIELDNODALGRADALGDRIVER_H
+#define MULTIFIELDNODALGRADALGDRIVER_H
+
+#include "ngp_algorithms/NgpAlgDriver.h"
+#include "ngp_algorithms/NodalGradAlgDriver.h"
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Compute the nodal gradients of several scalar fields together
+ *
+ *  The interior contribution is expected to be registered on this driver as a
+ *  single MultiFieldNodalGradEdgeAlg. The boundary contributions stay on the
+ *  per-field drivers added through add_field_driver, whose algorithms are
+ *  executed after the fused edge sweep. All gradients are then exchanged in a
+ *  single parallel sum.
+ */
+class MultiFieldNodalGradAlgDriver : public NgpAlgDriver
+{
+public:
+  MultiFieldNodalGradAlgDriver(Realm&);
+
+  virtual ~MultiFieldNodalGradAlgDriver() = default;
+
+  //! Add a field whose gradient is assembled by this driver
+  void add_field_driver(ScalarNodalGradAlgDriver&);
+
+  //! Reset all the gradient fields
+  virtual void pre_work() override;
+
+  //! Synchronize all the gradient fields
+  virtual void post_work() override;
+
+  virtual void execute() override;
+
+private:
+  std::vector<ScalarNodalGradAlgDriver*> fieldDrivers_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MULTIFIELDNODALGRADALGDRIVER_H */
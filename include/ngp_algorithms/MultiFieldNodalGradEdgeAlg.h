@@ -0,0 +1,64 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MULTIFIELDNODALGRADEDGEALG_H
+#define MULTIFIELDNODALGRADEDGEALG_H
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Edge-based Green-Gauss gradients for several scalar fields in one sweep
+ *
+ *  Equivalent to registering one ScalarNodalGradEdgeAlg per field, but the
+ *  edge area vector and the dual nodal volumes are loaded only once per edge
+ *  for all the fields.
+ */
+class MultiFieldNodalGradEdgeAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  //! Maximum number of fields that can be processed in a single sweep
+  static constexpr int MaxFields = 4;
+
+  MultiFieldNodalGradEdgeAlg(
+    Realm&,
+    stk::mesh::Part*,
+    const std::vector<ScalarFieldType*>& phis,
+    const std::vector<VectorFieldType*>& gradPhis);
+
+  virtual ~MultiFieldNodalGradEdgeAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  std::vector<unsigned> phi_;
+  std::vector<unsigned> gradPhi_;
+
+  unsigned edgeAreaVec_{stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVol_{stk::mesh::InvalidOrdinal};
+
+  //! Spatial dimension (2D or 3D)
+  const int dim2_;
+
+  //! Maximum size for static arrays used within device loops
+  static constexpr int NDimMax = 3;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MULTIFIELDNODALGRADEDGEALG_H */
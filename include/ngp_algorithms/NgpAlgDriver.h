@@ -44,6 +44,9 @@ public:
    */
   virtual void execute();
 
+  //! Execute the registered algorithms without any pre/post work
+  void execute_algorithms();
+
   /** Register an edge algorithm
    *
    *  Currently only interior algorithms can be edge algorithms
@@ -201,6 +204,10 @@ protected:
   std::map<std::string, std::unique_ptr<Algorithm>> algMap_;
 
   Realm& realm_;
+
+private:
+  //! Demangled class name for the profiling region, set on first use
+  std::string profilingName_;
 };
 
 } // namespace nalu
@@ -36,6 +36,9 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  const std::string& phi_name() const { return phiName_; }
+  const std::string& grad_phi_name() const { return gradPhiName_; }
+
 private:
   //! Field that is synchronized pre/post updates
   const std::string phiName_;
@@ -0,0 +1,114 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NODEKERNELPACK_H
+#define NODEKERNELPACK_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include <utility>
+
+namespace sierra {
+namespace nalu {
+
+namespace impl {
+
+/** Compile-time list of node kernels stored by value
+ *
+ *  The kernels are invoked through qualified calls, so the compiler can
+ *  resolve (and inline) each execute without going through the vtable.
+ */
+template <typename... Kernels>
+struct NodeKernelList
+{
+  void setup(Realm&) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&)
+  {
+  }
+};
+
+template <typename Kernel, typename... Rest>
+struct NodeKernelList<Kernel, Rest...>
+{
+  NodeKernelList(Kernel kernel, Rest... rest)
+    : head(std::move(kernel)), tail(std::move(rest)...)
+  {
+  }
+
+  void setup(Realm& realm)
+  {
+    head.setup(realm);
+    tail.setup(realm);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node)
+  {
+    head.Kernel::execute(lhs, rhs, node);
+    tail.execute(lhs, rhs, node);
+  }
+
+  Kernel head;
+  NodeKernelList<Rest...> tail;
+};
+
+} // namespace impl
+
+/** Fuse a fixed set of node kernels into a single NodeKernel
+ *
+ *  Equation systems that always register the same group of node kernels can
+ *  add them as one pack, e.g.,
+ *
+ *  ```
+ *  using PackType = NodeKernelPack<ScalarMassBDFNodeKernel, TKESSTNodeKernel>;
+ *  nodeAlg.add_kernel<PackType>(
+ *    ScalarMassBDFNodeKernel(bulk, tke), TKESSTNodeKernel(meta));
+ *  ```
+ *
+ *  The assembly loop then pays one virtual call per node for the whole group
+ *  instead of one per kernel.
+ */
+template <typename... Kernels>
+class NodeKernelPack : public NGPNodeKernel<NodeKernelPack<Kernels...>>
+{
+public:
+  NodeKernelPack(Kernels... kernels) : kernels_(std::move(kernels)...) {}
+
+  NodeKernelPack() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~NodeKernelPack() = default;
+
+  virtual void setup(Realm& realm) override { kernels_.setup(realm); }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node) override
+  {
+    kernels_.execute(lhs, rhs, node);
+  }
+
+private:
+  impl::NodeKernelList<Kernels...> kernels_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NODEKERNELPACK_H */
@@ -11,6 +11,7 @@
 #define GenericPropAlgorithm_h
 
 #include <Algorithm.h>
+#include <property_evaluator/NGPPropertyEvaluator.h>
 
 namespace stk {
 namespace mesh {
@@ -40,6 +41,7 @@ public:
 
   stk::mesh::FieldBase* prop_;
   PropertyEvaluator* propEvaluator_;
+  NGPPropertyEvaluator ngpPropEvaluator_;
 };
 
 } // namespace nalu
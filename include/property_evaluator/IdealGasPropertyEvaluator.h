@@ -41,6 +41,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   const double pRef_;
   const double R_;
   double mw_;
@@ -58,6 +60,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   double compute_mw(const double* yk);
 
   // reference quantities
@@ -83,6 +87,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   // reference quantities
   const double R_;
 
@@ -106,6 +112,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   double compute_mw(const double* yk);
 
   // reference quantities
@@ -0,0 +1,200 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NGPPropertyEvaluator_h
+#define NGPPropertyEvaluator_h
+
+#include <KokkosInterface.h>
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/NgpField.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_math/StkMath.hpp>
+
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Device-callable evaluation of the analytic property models
+ *
+ *  Host PropertyEvaluator instances that have a closed form return one of
+ *  these from PropertyEvaluator::ngp_evaluator. The evaluator is a value type
+ *  that is captured by the device lambdas of the property algorithms.
+ *
+ *  The mixture composition is either a fixed reference composition or the
+ *  nodal mass fractions, the pressure is either a fixed reference value or
+ *  the nodal pressure, and the temperature is either the nodal value supplied
+ *  by the caller or a fixed reference temperature.
+ */
+class NGPPropertyEvaluator
+{
+public:
+  enum Model {
+    INVALID = 0,
+    IDEAL_GAS,  //!< rho = p mw / (R T)
+    SUTHERLAND, //!< mu = sum_k Y_k mu_k(T)
+    NASA_CP,    //!< cp = R sum_k Y_k cp_r,k(T) / mw_k
+    POLYNOMIAL  //!< (scale T^p sum_i c_i T^i - subtract) + add
+  };
+
+  using CoeffView = Kokkos::View<double**, MemSpace>;
+  using WeightView = Kokkos::View<double*, MemSpace>;
+
+  NGPPropertyEvaluator() = default;
+
+  //! Ideal gas density with the mixture molecular weight of the reference
+  //! composition; use set_mass_fraction to compute it from nodal values
+  static NGPPropertyEvaluator ideal_gas(
+    double pRef, double universalR, double mw, const std::vector<double>& mwk);
+
+  //! Sutherland viscosity; coeffs[k] = {muRef, TRef, SRef}
+  static NGPPropertyEvaluator sutherland(
+    const std::vector<double>& refMassFraction,
+    const std::vector<std::vector<double>>& coeffs);
+
+  //! Five-coefficient NASA specific heat with low/high temperature ranges
+  static NGPPropertyEvaluator nasa_cp(
+    double universalR,
+    double tLowHigh,
+    const std::vector<double>& refMassFraction,
+    const std::vector<double>& mw,
+    const std::vector<std::vector<double>>& lowCoeffs,
+    const std::vector<std::vector<double>>& highCoeffs);
+
+  //! Single polynomial in temperature
+  static NGPPropertyEvaluator polynomial(
+    const std::vector<double>& coeffs,
+    double scale = 1.0,
+    int tPower = 0,
+    double subtract = 0.0,
+    double add = 0.0);
+
+  //! Use the nodal mass fractions instead of the reference composition
+  void set_mass_fraction(const stk::mesh::FieldBase& massFraction);
+
+  //! Use the nodal pressure instead of the reference pressure
+  void set_pressure(const stk::mesh::FieldBase& pressure);
+
+  //! Evaluate at a fixed temperature instead of the nodal one
+  void set_fixed_temperature(double tRef);
+
+  bool is_valid() const { return model_ != INVALID; }
+
+  //! True if the evaluator needs the caller to supply a temperature
+  bool needs_temperature() const { return !fixedTemperature_; }
+
+  //! Refresh the NGP field instances of the nodal inputs on device
+  void update_fields();
+
+  KOKKOS_INLINE_FUNCTION
+  double
+  operator()(const stk::mesh::FastMeshIndex& node, const double TNode) const
+  {
+    const double T = fixedTemperature_ ? tRef_ : TNode;
+
+    switch (model_) {
+    case IDEAL_GAS: {
+      double mw = mw_;
+      if (nodalMassFraction_) {
+        double sum = 0.0;
+        for (int k = 0; k < numSpecies_; ++k)
+          sum += massFraction_.get(node, k) / weights_(k);
+        mw = 1.0 / sum;
+      }
+      const double P = nodalPressure_ ? pressure_.get(node, 0) : pRef_;
+      return P * mw / R_ / T;
+    }
+    case SUTHERLAND: {
+      double sum_mu = 0.0;
+      for (int k = 0; k < numSpecies_; ++k) {
+        const double muRef = coeffs_(k, 0);
+        const double TRef = coeffs_(k, 1);
+        const double SRef = coeffs_(k, 2);
+        sum_mu += mass_fraction(node, k) * muRef *
+                  stk::math::pow(T / TRef, 1.5) * (TRef + SRef) / (T + SRef);
+      }
+      return sum_mu;
+    }
+    case NASA_CP: {
+      const int offset = (T < tLowHigh_) ? 0 : 5;
+      double sum_cp_r = 0.0;
+      for (int k = 0; k < numSpecies_; ++k) {
+        const double cp_r = coeffs_(k, offset) + coeffs_(k, offset + 1) * T +
+                            coeffs_(k, offset + 2) * T * T +
+                            coeffs_(k, offset + 3) * T * T * T +
+                            coeffs_(k, offset + 4) * T * T * T * T;
+        sum_cp_r += mass_fraction(node, k) * cp_r / mw_k(k);
+      }
+      return sum_cp_r * R_;
+    }
+    case POLYNOMIAL: {
+      const int nCoeffs = coeffs_.extent(1);
+      double value = coeffs_(0, nCoeffs - 1);
+      for (int i = nCoeffs - 2; i >= 0; --i)
+        value = coeffs_(0, i) + T * value;
+      for (int p = 0; p < tPower_; ++p)
+        value = T * value;
+      return (value * scale_ - subtract_) + add_;
+    }
+    default:
+      return 0.0;
+    }
+  }
+
+private:
+  KOKKOS_INLINE_FUNCTION
+  double mass_fraction(const stk::mesh::FastMeshIndex& node, const int k) const
+  {
+    return nodalMassFraction_ ? massFraction_.get(node, k) : weights_(k);
+  }
+
+  //! Species molecular weights (NASA_CP keeps them in the last column)
+  KOKKOS_INLINE_FUNCTION
+  double mw_k(const int k) const { return coeffs_(k, 10); }
+
+  static CoeffView create_coeffs(
+    const std::string& name, const std::vector<std::vector<double>>& coeffs);
+
+  static WeightView
+  create_weights(const std::string& name, const std::vector<double>& weights);
+
+  Model model_{INVALID};
+  int numSpecies_{0};
+
+  double pRef_{0.0};
+  double R_{0.0};
+  double mw_{0.0};
+  double tRef_{0.0};
+  double tLowHigh_{0.0};
+  double scale_{1.0};
+  double subtract_{0.0};
+  double add_{0.0};
+  int tPower_{0};
+
+  //! Reference mass fractions, or species molecular weights for IDEAL_GAS
+  WeightView weights_;
+  //! Per-species model coefficients (row 0 only for POLYNOMIAL)
+  CoeffView coeffs_;
+
+  bool fixedTemperature_{false};
+  bool nodalMassFraction_{false};
+  bool nodalPressure_{false};
+  const stk::mesh::FieldBase* massFractionField_{nullptr};
+  const stk::mesh::FieldBase* pressureField_{nullptr};
+  stk::mesh::NgpField<double> massFraction_;
+  stk::mesh::NgpField<double> pressure_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -10,6 +10,8 @@
 #ifndef PropertyEvaluator_h
 #define PropertyEvaluator_h
 
+#include <property_evaluator/NGPPropertyEvaluator.h>
+
 #include <stk_mesh/base/Entity.hpp>
 
 #include <vector>
@@ -25,6 +27,12 @@ public:
 
   virtual double
   execute(double* indVarList, stk::mesh::Entity node = stk::mesh::Entity()) = 0;
+
+  //! Device evaluator of the model; invalid if the model is host-only
+  virtual NGPPropertyEvaluator ngp_evaluator() const
+  {
+    return NGPPropertyEvaluator();
+  }
 };
 
 } // namespace nalu
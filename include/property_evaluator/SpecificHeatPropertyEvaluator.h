@@ -42,6 +42,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   double compute_cp_r(const double& T, const double* pt_poly);
 
   std::vector<double> refMassFraction_;
@@ -62,6 +64,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   double compute_cp_r(const double& T, const double* pt_poly);
 
   // field definition and extraction
@@ -44,6 +44,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   double compute_viscosity(const double& T, const double* pt_poly);
 
   std::vector<double> refMassFraction_;
@@ -61,6 +63,8 @@ public:
 
   virtual double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   virtual double compute_viscosity(const double& T, const double* pt_poly);
 
   // field definition and extraction
@@ -83,6 +87,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   const double tRef_;
 };
 
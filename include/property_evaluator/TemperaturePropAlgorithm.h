@@ -11,6 +11,7 @@
 #define TemperaturePropAlgorithm_h
 
 #include <Algorithm.h>
+#include <property_evaluator/NGPPropertyEvaluator.h>
 
 // standard c++
 #include <string>
@@ -44,6 +45,7 @@ public:
 
   stk::mesh::FieldBase* prop_;
   PropertyEvaluator* propEvaluator_;
+  NGPPropertyEvaluator ngpPropEvaluator_;
   stk::mesh::FieldBase* temperature_;
 };
 
@@ -38,6 +38,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -52,6 +54,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -67,6 +71,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -83,7 +89,9 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
-  double compute_h(const double T);
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
+  double compute_h(const double T) const;
 
   // reference quantities
   const double aw_;
@@ -103,6 +111,8 @@ public:
 
   double execute(double* indVarList, stk::mesh::Entity node);
 
+  NGPPropertyEvaluator ngp_evaluator() const override;
+
   // reference quantities
   const double aw_;
   const double bw_;
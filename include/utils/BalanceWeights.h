@@ -0,0 +1,63 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef BALANCEWEIGHTS_H
+#define BALANCEWEIGHTS_H
+
+#include <map>
+#include <string>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+template <typename T>
+class Field;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Static model of the work per element used to weight the rebalance
+ *
+ *  Every element costs ``defaultWeight`` unless its block is listed in
+ *  ``blockWeights``. Each face of a side set listed in ``faceWeights`` adds
+ *  its weight to the elements it is attached to, which accounts for
+ *  wall-function and interface boundaries being more expensive than the
+ *  interior.
+ */
+struct BalanceWeightOptions
+{
+  bool active{false};
+  double defaultWeight{1.0};
+  std::map<std::string, double> blockWeights;
+  std::map<std::string, double> faceWeights;
+};
+
+void load_balance_weight_options(
+  const YAML::Node& node, BalanceWeightOptions& options);
+
+/** Fill the element field weights from the cost model
+ *
+ *  Only locally owned elements are assigned; the field must be defined on
+ *  every element block.
+ */
+void compute_balance_weights(
+  const stk::mesh::BulkData& bulk,
+  const BalanceWeightOptions& options,
+  stk::mesh::Field<double>& weights);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* BALANCEWEIGHTS_H */
@@ -0,0 +1,133 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef COMPACTEDGECONNECTIVITY_H
+#define COMPACTEDGECONNECTIVITY_H
+
+#include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/NgpMesh.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Edges of a mesh stored as plain arrays instead of STK edge entities
+ *
+ *  The edges are extracted from the element topologies and deduplicated;
+ *  nothing is added to the STK mesh. Each edge is stored as a node pair
+ *  ordered by increasing identifier, and the edges are sorted by their first
+ *  node so that they form a compressed row structure over the nodes, which
+ *  is what the linear system graph builders need.
+ *
+ *  Only the edges owned by this rank are kept. An edge is owned by the lowest
+ *  rank that owns one of the elements containing it, so the element selector
+ *  should include the aura elements when running in parallel; every edge is
+ *  then visited by exactly one rank, like the locally owned STK edges.
+ *
+ *  The device views hold the nodes of each edge and, once computed, the edge
+ *  area vector oriented from the first to the second node. The arrays are
+ *  only valid until nodes or elements are created or destroyed; sorting the
+ *  entities within their buckets does not invalidate them.
+ */
+class CompactEdgeConnectivity
+{
+public:
+  using EdgeNodeView =
+    Kokkos::View<stk::mesh::Entity* [2], Kokkos::LayoutRight, MemSpace>;
+  using AreaVectorView = Kokkos::View<double**, MemSpace>;
+
+  //! Extract the edges of the elements selected by elemSelector
+  CompactEdgeConnectivity(
+    const stk::mesh::BulkData& bulk, const stk::mesh::Selector& elemSelector);
+
+  size_t num_edges() const { return edgeNodes_.size() / 2; }
+
+  //! Nodes of edge i; the first has the lower identifier
+  stk::mesh::Entity node(size_t i, int j) const
+  {
+    return edgeNodes_[2 * i + j];
+  }
+
+  //! Nodes that start at least one edge
+  const std::vector<stk::mesh::Entity>& row_nodes() const { return rowNodes_; }
+
+  //! Edges of row r are [row_offsets()[r], row_offsets()[r + 1])
+  const std::vector<size_t>& row_offsets() const { return rowOffsets_; }
+
+  //! Index of the edge connecting two nodes, or num_edges() if not owned here
+  size_t find_edge(stk::mesh::Entity n0, stk::mesh::Entity n1) const;
+
+  /** Sum the subcontrol surface area vectors of the selected elements
+   *
+   *  Must be called again whenever the coordinates change.
+   */
+  void compute_area_vectors(const VectorFieldType& coordinates);
+
+  EdgeNodeView edge_nodes() const { return edgeNodesDevice_; }
+
+  AreaVectorView area_vectors() const { return areaVectors_; }
+
+  //! Bytes held on host and device
+  size_t memory_usage() const;
+
+  //! Bytes that memory_usage() reports for the given sizes
+  static size_t
+  estimate_memory_usage(size_t numEdges, size_t numRowNodes, int nDim);
+
+private:
+  const stk::mesh::BulkData& bulk_;
+  const stk::mesh::Selector elemSelector_;
+
+  std::vector<stk::mesh::Entity> edgeNodes_;
+  std::vector<stk::mesh::Entity> rowNodes_;
+  std::vector<size_t> rowOffsets_;
+
+  EdgeNodeView edgeNodesDevice_;
+  AreaVectorView areaVectors_;
+};
+
+/** Execute the given functor for all compact edges in a Kokkos parallel loop
+ *
+ *  The functor is called with the edge index and the NGP mesh indices of its
+ *  two nodes.
+ */
+template <typename AlgFunctor>
+inline void
+run_compact_edge_algorithm(
+  const std::string& algName,
+  const stk::mesh::NgpMesh& ngpMesh,
+  const CompactEdgeConnectivity& edges,
+  const AlgFunctor algorithm)
+{
+  const auto edgeNodes = edges.edge_nodes();
+  Kokkos::parallel_for(
+    algName, DeviceRangePolicy(0, edges.num_edges()),
+    KOKKOS_LAMBDA(const size_t ie) {
+      algorithm(
+        ie, ngpMesh.fast_mesh_index(edgeNodes(ie, 0)),
+        ngpMesh.fast_mesh_index(edgeNodes(ie, 1)));
+    });
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* COMPACTEDGECONNECTIVITY_H */
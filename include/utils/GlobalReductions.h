@@ -0,0 +1,89 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef GLOBALREDUCTIONS_H
+#define GLOBALREDUCTIONS_H
+
+#include <mpi.h>
+
+#include <functional>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Scalar reductions packed into a single non-blocking collective
+ *
+ *  Algorithms register their local contributions along with the reduction
+ *  operation and the location of the global result instead of issuing their
+ *  own all-reduce. All contributions pending at a sync point are reduced by
+ *  one MPI_Iallreduce; start() posts it so that it can overlap with other
+ *  work and finish() completes it, writes the results and runs the completion
+ *  callbacks.
+ *
+ *  Registration is collective in the sense that every rank must register the
+ *  same contributions in the same order. Code that reads a registered result
+ *  must call finish() first.
+ */
+class GlobalReductions
+{
+public:
+  enum class Op { SUM = 0, MIN = 1, MAX = 2 };
+
+  explicit GlobalReductions(MPI_Comm comm);
+  ~GlobalReductions();
+
+  GlobalReductions(const GlobalReductions&) = delete;
+  GlobalReductions& operator=(const GlobalReductions&) = delete;
+
+  /** Register a local value whose global reduction is written to result
+   *
+   *  Registering the same result again before the sync point replaces the
+   *  earlier contribution.
+   */
+  void add(Op op, double localValue, double* result);
+
+  //! Run callback once the pending contributions have been reduced
+  void on_completion(std::function<void()> callback);
+
+  //! Post the reduction of the pending contributions
+  void start();
+
+  //! Complete the reduction, deliver the results and run the callbacks
+  void finish();
+
+  size_t num_pending() const { return results_.size(); }
+
+  //! Number of collectives issued so far
+  size_t num_reductions() const { return numReductions_; }
+
+private:
+  MPI_Comm comm_;
+  MPI_Datatype entryType_{MPI_DATATYPE_NULL};
+  MPI_Op entryOp_{MPI_OP_NULL};
+
+  //! Pending (value, op) pairs and where their global values go
+  std::vector<double> entries_;
+  std::vector<double*> results_;
+  std::vector<std::function<void()>> callbacks_;
+
+  //! Contributions and callbacks of the posted reduction
+  std::vector<double> sendBuffer_;
+  std::vector<double> recvBuffer_;
+  std::vector<double*> postedResults_;
+  std::vector<std::function<void()>> postedCallbacks_;
+  MPI_Request request_{MPI_REQUEST_NULL};
+
+  size_t numReductions_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* GLOBALREDUCTIONS_H */
@@ -0,0 +1,84 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include "stk_mesh/base/BulkData.hpp"
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+//! Named amounts (bytes or counts) on this rank
+using MemoryEntries = std::vector<std::pair<std::string, double>>;
+
+//! Bytes allocated for each field on this rank; all states of a field combined
+MemoryEntries field_memory_usage(const stk::mesh::BulkData& bulk);
+
+//! Number of owned, shared and ghosted entities of each rank
+MemoryEntries entity_counts(const stk::mesh::BulkData& bulk);
+
+//! Bytes used by the connectivity of the entities of each rank
+MemoryEntries connectivity_memory_usage(const stk::mesh::BulkData& bulk);
+
+/** Live Kokkos allocations per memory space and label
+ *
+ *  Registers the Kokkos tools allocation callbacks, so it is only installed
+ *  when no Kokkos tool is loaded; allocations made before installation are
+ *  not accounted for.
+ */
+class KokkosAllocationTracker
+{
+public:
+  static KokkosAllocationTracker& self();
+
+  //! Register the callbacks; returns false if a Kokkos tool is loaded
+  bool install();
+
+  bool installed() const { return installed_; }
+
+  //! Bytes currently allocated, keyed by "space:label"
+  MemoryEntries current_usage() const;
+
+  void allocate(const char* space, const char* label, uint64_t size);
+  void deallocate(const char* space, const char* label, uint64_t size);
+
+private:
+  KokkosAllocationTracker() = default;
+
+  bool installed_{false};
+  std::map<std::string, double> bytes_;
+};
+
+/** Print the min, max and sum over all ranks of named amounts
+ *
+ *  Collective over comm. Entries are matched by name across ranks, missing
+ *  entries count as zero, and only the maxEntries largest (by sum) are
+ *  listed individually; the remainder is lumped into a single line whose
+ *  min/max are the sums of the per entry min/max.
+ */
+void report_memory_usage(
+  std::ostream& out,
+  const std::string& title,
+  const MemoryEntries& localEntries,
+  MPI_Comm comm,
+  bool inBytes = true,
+  size_t maxEntries = 20);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MEMORYUSAGE_H */
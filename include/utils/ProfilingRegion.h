@@ -0,0 +1,111 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PROFILINGREGION_H
+#define PROFILINGREGION_H
+
+#include <mpi.h>
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Aggregated timings of nested profiling regions
+ *
+ *  Every region opened through ProfilingRegion is recorded in a call tree, so
+ *  that the same region name reached from different callers is accounted for
+ *  separately. The tree keeps the number of calls and the inclusive time of
+ *  each region along with the time spent in its child regions, which gives
+ *  the exclusive time. Recording is disabled by default; the Kokkos tools
+ *  regions are always emitted.
+ */
+class ProfilingRegistry
+{
+public:
+  struct Node
+  {
+    std::string name;
+    int parent{-1};
+    std::map<std::string, int> children;
+    std::vector<int> childOrder;
+    long calls{0};
+    double inclusive{0.0};
+    double childTime{0.0};
+    double start{0.0};
+
+    double exclusive() const { return inclusive - childTime; }
+  };
+
+  static ProfilingRegistry& self();
+
+  void set_enabled(bool enabled) { enabled_ = enabled; }
+  bool enabled() const { return enabled_; }
+
+  //! Open a region nested within the innermost open region
+  void push(const std::string& name);
+
+  //! Close the innermost open region
+  void pop();
+
+  //! Discard all the recorded timings
+  void reset();
+
+  //! Node at the given path from the root; nullptr if it was never opened
+  const Node* find(const std::vector<std::string>& path) const;
+
+  /** Print the call tree with the timings reduced over all ranks
+   *
+   *  Collective over comm; regions that were only visited on some ranks are
+   *  reported with zero time and calls on the others.
+   */
+  void report(std::ostream& out, MPI_Comm comm) const;
+
+private:
+  ProfilingRegistry();
+
+  std::vector<std::string> path_of(int node) const;
+
+  bool enabled_{false};
+  std::vector<Node> nodes_;
+  std::vector<int> stack_;
+};
+
+/** Scoped profiling region
+ *
+ *  Emits a Kokkos tools region and, when the registry is enabled, records the
+ *  time spent in the scope in the ProfilingRegistry.
+ */
+class ProfilingRegion
+{
+public:
+  explicit ProfilingRegion(const std::string& name);
+  ~ProfilingRegion();
+
+  ProfilingRegion(const ProfilingRegion&) = delete;
+  ProfilingRegion& operator=(const ProfilingRegion&) = delete;
+
+  //! True if regions are recorded or a Kokkos tool is listening
+  static bool active();
+
+private:
+  const bool recorded_;
+};
+
+//! Class name of a polymorphic object without the nalu namespaces
+std::string profiling_type_name(const std::type_info& type);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* PROFILINGREGION_H */
@@ -5,6 +5,7 @@
 
 #include "AssembleElemSolverAlgorithm.h"
 #include "AssembleFaceElemSolverAlgorithm.h"
+#include "AssembleNGPNodeSolverAlgorithm.h"
 #include "TpetraLinearSystem.h"
 #include "EquationSystem.h"
 #include "kernel/Kernel.h"
@@ -277,6 +278,31 @@ struct TpetraHelperObjectsEdge : public TpetraHelperObjectsBase
   sierra::nalu::AssembleEdgeSolverAlgorithm* edgeAlg;
 };
 
+struct TpetraHelperObjectsNode : public TpetraHelperObjectsBase
+{
+  TpetraHelperObjectsNode(
+    std::shared_ptr<stk::mesh::BulkData> bulk,
+    int numDof,
+    stk::mesh::Part* part)
+    : TpetraHelperObjectsBase(bulk, numDof),
+      nodeAlg(new sierra::nalu::AssembleNGPNodeSolverAlgorithm(
+        realm, part, &eqSystem))
+  {
+  }
+
+  virtual void execute() override
+  {
+    linsys->buildNodeGraph({&realm.meta_data().universal_part()});
+    linsys->finalizeLinearSystem();
+
+    nodeAlg->execute();
+
+    linsys->loadComplete();
+  }
+
+  std::unique_ptr<sierra::nalu::AssembleNGPNodeSolverAlgorithm> nodeAlg;
+};
+
 } // namespace unit_test_utils
 
 #endif